@@ -0,0 +1,512 @@
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+
+/*!
+	\file HashBenchmark.cpp
+	\brief Speed and quality measurements for every hash in Solaire/Maths/Hash.
+	\details
+	Build this file together with the .cpp files in Src/Solaire/Maths/Hash and Src/Solaire/Maths/CpuDispatch.cpp, with
+	optimisations and the instruction sets of the target machine enabled (for example -O2 -march=native).
+
+	Usage : HashBenchmark [--format=csv|json] [--filter=NAME] [--max-size=BYTES] [--min-time=SECONDS]
+	                      [--keys=COUNT] [--trials=COUNT] [--no-speed] [--no-quality]
+
+	Every result is one record of hash, test, key set, size, metric and value, written as CSV or a JSON array.
+	Speed tests :
+		throughput		Independent keys of each size from 4 bytes up to --max-size, GB/s and cycles/byte.
+		latency			Each key address depends on the previous hash, nanoseconds and cycles per hash.
+	Quality tests, modelled on SMHasher :
+		avalanche		Flip every input bit of random keys, worst and mean bias of the output bits (0 is ideal, 1 is worst).
+		buckets			Chi-square of the low and high bits of the hash as a table index, as a z-score (about +-3 is ideal).
+		collisions		Full width collisions, observed and expected for an ideal hash of the same width.
+	Crc32+Addler32+Xxh3 and MultiChecksum compare three separate passes over the data with one fused pass, and only have
+	speed tests.
+	Cycles are read from the time stamp counter, which counts at a fixed rate that may differ from the core clock.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 16th October 2026
+	Last Modified	: 16th October 2026
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+#include "Solaire\Maths\Hash\Addler.hpp"
+#include "Solaire\Maths\Hash\Crc.hpp"
+#include "Solaire\Maths\Hash\Djb2.hpp"
+#include "Solaire\Maths\Hash\MultiChecksum.hpp"
+#include "Solaire\Maths\Hash\MurmurHash3.hpp"
+#include "Solaire\Maths\Hash\Sdbm.hpp"
+#include "Solaire\Maths\Hash\SipHash.hpp"
+#include "Solaire\Maths\Hash\Sum.hpp"
+#include "Solaire\Maths\Hash\WyHash.hpp"
+#include "Solaire\Maths\Hash\XxHash.hpp"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #define SOLAIRE_BENCHMARK_RDTSC 1
+    #include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+    #define SOLAIRE_BENCHMARK_RDTSC 1
+    #include <x86intrin.h>
+#else
+    #define SOLAIRE_BENCHMARK_RDTSC 0
+#endif
+
+using namespace Solaire;
+
+namespace {
+
+    // Options
+
+    enum Format {
+        FORMAT_CSV,
+        FORMAT_JSON
+    };
+
+    struct Options {
+        Format OutputFormat;
+        std::string Filter;
+        size_t MaxSize;
+        double MinTime;
+        size_t Keys;
+        size_t Trials;
+        bool Speed;
+        bool Quality;
+
+        Options() :
+            OutputFormat(FORMAT_CSV),
+            MaxSize(static_cast<size_t>(1) << 30),
+            MinTime(0.05),
+            Keys(static_cast<size_t>(1) << 20),
+            Trials(static_cast<size_t>(1) << 12),
+            Speed(true),
+            Quality(true)
+        {}
+    };
+
+    // Output
+
+    class Report {
+    private:
+        Format mFormat;
+        size_t mRecords;
+    public:
+        Report(const Format aFormat) :
+            mFormat(aFormat),
+            mRecords(0)
+        {
+            if(mFormat == FORMAT_CSV) {
+                std::printf("hash,test,keys,size,metric,value\n");
+            }else {
+                std::printf("[");
+            }
+        }
+
+        ~Report() {
+            if(mFormat == FORMAT_JSON) std::printf("\n]\n");
+            std::fflush(stdout);
+        }
+
+        void Add(const char* const aHash, const char* const aTest, const char* const aKeys, const size_t aSize, const char* const aMetric, const double aValue) {
+            if(mFormat == FORMAT_CSV) {
+                std::printf("%s,%s,%s,%llu,%s,%.9g\n", aHash, aTest, aKeys, static_cast<unsigned long long>(aSize), aMetric, aValue);
+            }else {
+                std::printf("%s\n  {\"hash\":\"%s\",\"test\":\"%s\",\"keys\":\"%s\",\"size\":%llu,\"metric\":\"%s\",\"value\":%.9g}",
+                    mRecords == 0 ? "" : ",", aHash, aTest, aKeys, static_cast<unsigned long long>(aSize), aMetric, aValue
+                );
+            }
+            ++mRecords;
+            std::fflush(stdout);
+        }
+    };
+
+    // Timing
+
+    volatile uint64_t gSink = 0;
+
+    static uint64_t ReadCycles() throw() {
+        #if SOLAIRE_BENCHMARK_RDTSC
+            return __rdtsc();
+        #else
+            return 0;
+        #endif
+    }
+
+    struct Timing {
+        double Seconds;
+        double Cycles;
+    };
+
+    /*!
+        \brief Double the number of iterations until a run lasts at least aMinTime.
+        \param aRun Called with an iteration count, returns a value that depends on every hash.
+    */
+    template<class RUN>
+    static Timing Measure(const RUN& aRun, const double aMinTime, size_t& aIterations) {
+        typedef std::chrono::steady_clock Clock;
+
+        aIterations = 1;
+        while(true) {
+            const Clock::time_point begin = Clock::now();
+            const uint64_t cycles = ReadCycles();
+            gSink = gSink + aRun(aIterations);
+            const uint64_t cyclesEnd = ReadCycles();
+            const Timing timing = {
+                std::chrono::duration<double>(Clock::now() - begin).count(),
+                static_cast<double>(cyclesEnd - cycles)
+            };
+            if(timing.Seconds >= aMinTime || aIterations >= (static_cast<size_t>(1) << 40)) return timing;
+            aIterations *= 2;
+        }
+    }
+
+    // Key sets
+
+    static void FillRandom(uint8_t* const aData, const size_t aBytes, const uint64_t aSeed) {
+        // SplitMix64 is fast enough to fill a gigabyte without dominating the run time
+        uint64_t state = aSeed;
+        for(size_t i = 0; i < aBytes; i += sizeof(uint64_t)) {
+            uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            z ^= z >> 31;
+            std::memcpy(aData + i, &z, std::min<size_t>(sizeof(uint64_t), aBytes - i));
+        }
+    }
+
+    /*!
+        \brief Fixed size keys stored back to back.
+    */
+    struct KeySet {
+        const char* Name;
+        size_t Size;
+        std::vector<uint8_t> Data;
+
+        const uint8_t* operator[](const size_t aIndex) const {
+            return Data.data() + aIndex * Size;
+        }
+    };
+
+    static std::vector<KeySet> MakeKeySets(const size_t aCount) {
+        std::vector<KeySet> sets(3);
+
+        // Little endian counters, the keys a hash table of integers sees
+        sets[0].Name = "sequential";
+        sets[0].Size = sizeof(uint64_t);
+        sets[0].Data.resize(aCount * sizeof(uint64_t));
+        for(size_t i = 0; i < aCount; ++i) {
+            const uint64_t key = i;
+            for(size_t j = 0; j < sizeof(uint64_t); ++j) sets[0].Data[i * sizeof(uint64_t) + j] = static_cast<uint8_t>(key >> (j * 8));
+        }
+
+        // Short text that only differs in its last characters
+        sets[1].Name = "text";
+        sets[1].Size = 16;
+        sets[1].Data.resize(aCount * 16);
+        for(size_t i = 0; i < aCount; ++i) {
+            char key[32];
+            std::snprintf(key, sizeof(key), "key_%012llu", static_cast<unsigned long long>(i % 1000000000000ULL));
+            std::memcpy(sets[1].Data.data() + i * 16, key, 16);
+        }
+
+        sets[2].Name = "random";
+        sets[2].Size = 16;
+        sets[2].Data.resize(aCount * 16);
+        FillRandom(sets[2].Data.data(), sets[2].Data.size(), 0x5EED);
+
+        return sets;
+    }
+
+    // Speed
+
+    template<class POLICY>
+    static void RunSpeed(const char* const aName, const Options& aOptions, const uint8_t* const aData, const size_t aDataBytes, Report& aReport) {
+        enum : size_t{
+            SMALL_REGION = 64 * 1024,
+            OFFSETS = 64
+        };
+
+        for(size_t size = 4; size <= aOptions.MaxSize && size + OFFSETS <= aDataBytes; size *= 2) {
+            size_t iterations;
+
+            // Hash independent keys, small keys are taken from a region that stays in the cache
+            const size_t region = std::min<size_t>(aDataBytes, std::max<size_t>(SMALL_REGION, size + OFFSETS));
+            const size_t keys = (region - OFFSETS) / size;
+            const Timing throughput = Measure([=](const size_t aIterations) {
+                uint64_t sum = 0;
+                size_t key = 0;
+                for(size_t i = 0; i < aIterations; ++i) {
+                    sum += static_cast<uint64_t>(POLICY::Hash(aData + key * size + (i & (OFFSETS - 1)), size));
+                    if(++key == keys) key = 0;
+                }
+                return sum;
+            }, aOptions.MinTime, iterations);
+
+            const double bytes = static_cast<double>(size) * static_cast<double>(iterations);
+            aReport.Add(aName, "throughput", "random", size, "GB/s", bytes / throughput.Seconds / 1e9);
+            if(SOLAIRE_BENCHMARK_RDTSC) aReport.Add(aName, "throughput", "random", size, "cycles/byte", throughput.Cycles / bytes);
+
+            // The next key depends on the previous hash, so hashes cannot overlap
+            if(size <= 4096) {
+                const Timing latency = Measure([=](const size_t aIterations) {
+                    uint64_t hash = 0;
+                    for(size_t i = 0; i < aIterations; ++i) {
+                        hash = static_cast<uint64_t>(POLICY::Hash(aData + (hash & (OFFSETS - 1)), size));
+                    }
+                    return hash;
+                }, aOptions.MinTime, iterations);
+
+                aReport.Add(aName, "latency", "random", size, "ns/hash", latency.Seconds / static_cast<double>(iterations) * 1e9);
+                if(SOLAIRE_BENCHMARK_RDTSC) aReport.Add(aName, "latency", "random", size, "cycles/hash", latency.Cycles / static_cast<double>(iterations));
+            }
+        }
+    }
+
+    // Quality
+
+    template<class POLICY>
+    static void RunAvalanche(const char* const aName, const Options& aOptions, Report& aReport) {
+        typedef typename POLICY::HashType HashType;
+        enum : size_t{
+            HASH_BITS = sizeof(HashType) * 8
+        };
+
+        static const size_t SIZES[] = {4, 8, 16, 32};
+        std::mt19937_64 random(0xA5A5);
+
+        for(const size_t size : SIZES) {
+            std::vector<uint32_t> flips(size * 8 * HASH_BITS, 0);
+            uint8_t key[32];
+
+            for(size_t trial = 0; trial < aOptions.Trials; ++trial) {
+                for(size_t i = 0; i < size; ++i) key[i] = static_cast<uint8_t>(random());
+                const HashType hash = POLICY::Hash(key, size);
+
+                for(size_t bit = 0; bit < size * 8; ++bit) {
+                    key[bit / 8] ^= static_cast<uint8_t>(1 << (bit % 8));
+                    const HashType difference = static_cast<HashType>(hash ^ POLICY::Hash(key, size));
+                    key[bit / 8] ^= static_cast<uint8_t>(1 << (bit % 8));
+
+                    uint32_t* const counts = flips.data() + bit * HASH_BITS;
+                    for(size_t i = 0; i < HASH_BITS; ++i) counts[i] += static_cast<uint32_t>((difference >> i) & 1);
+                }
+            }
+
+            double worst = 0.0;
+            double mean = 0.0;
+            for(const uint32_t count : flips) {
+                const double bias = std::fabs(2.0 * static_cast<double>(count) / static_cast<double>(aOptions.Trials) - 1.0);
+                worst = std::max(worst, bias);
+                mean += bias;
+            }
+            mean /= static_cast<double>(flips.size());
+
+            aReport.Add(aName, "avalanche", "random", size, "worst bias", worst);
+            aReport.Add(aName, "avalanche", "random", size, "mean bias", mean);
+        }
+    }
+
+    static double BucketScore(const std::vector<uint64_t>& aHashes, const uint32_t aShift, const uint32_t aBits) {
+        const size_t buckets = static_cast<size_t>(1) << aBits;
+        std::vector<uint32_t> counts(buckets, 0);
+        for(const uint64_t hash : aHashes) ++counts[(hash >> aShift) & (buckets - 1)];
+
+        const double expected = static_cast<double>(aHashes.size()) / static_cast<double>(buckets);
+        double chiSquare = 0.0;
+        for(const uint32_t count : counts) {
+            const double difference = static_cast<double>(count) - expected;
+            chiSquare += difference * difference / expected;
+        }
+
+        const double freedom = static_cast<double>(buckets - 1);
+        return (chiSquare - freedom) / std::sqrt(2.0 * freedom);
+    }
+
+    static double ExpectedCollisions(const size_t aKeys, const uint32_t aBits) {
+        // Keys minus the expected number of distinct values when aKeys values are drawn from 2^aBits
+        const long double values = std::ldexp(1.0L, static_cast<int>(aBits));
+        const long double keys = static_cast<long double>(aKeys);
+        const long double distinct = -values * std::expm1(keys * std::log1p(-1.0L / values));
+        return static_cast<double>(keys - distinct);
+    }
+
+    template<class POLICY>
+    static void RunDistribution(const char* const aName, const std::vector<KeySet>& aKeySets, Report& aReport) {
+        typedef typename POLICY::HashType HashType;
+        const uint32_t hashBits = sizeof(HashType) * 8;
+        static const uint32_t BUCKET_BITS[] = {8, 12, 16};
+
+        for(const KeySet& set : aKeySets) {
+            const size_t keys = set.Data.size() / set.Size;
+            std::vector<uint64_t> hashes(keys);
+            for(size_t i = 0; i < keys; ++i) hashes[i] = static_cast<uint64_t>(POLICY::Hash(set[i], set.Size));
+
+            for(const uint32_t bits : BUCKET_BITS) {
+                if(bits > hashBits || (static_cast<size_t>(1) << bits) * 16 > keys) continue;
+                char metric[32];
+                std::snprintf(metric, sizeof(metric), "low %u bits z", bits);
+                aReport.Add(aName, "buckets", set.Name, set.Size, metric, BucketScore(hashes, 0, bits));
+                std::snprintf(metric, sizeof(metric), "high %u bits z", bits);
+                aReport.Add(aName, "buckets", set.Name, set.Size, metric, BucketScore(hashes, hashBits - bits, bits));
+            }
+
+            std::sort(hashes.begin(), hashes.end());
+            const size_t distinct = static_cast<size_t>(std::unique(hashes.begin(), hashes.end()) - hashes.begin());
+            aReport.Add(aName, "collisions", set.Name, set.Size, "observed", static_cast<double>(keys - distinct));
+            aReport.Add(aName, "collisions", set.Name, set.Size, "expected", ExpectedCollisions(keys, hashBits));
+        }
+    }
+
+    // Multiple checksums, speed only
+
+    struct SeparateChecksumsPolicy {
+        typedef uint64_t HashType;
+
+        static inline HashType Hash(const void* const aValue, const size_t aBytes) throw() {
+            return Crc32::Policy::Hash(aValue, aBytes) ^ Addler32::Policy::Hash(aValue, aBytes) ^ Xxh3::Policy::Hash(aValue, aBytes);
+        }
+    };
+
+    struct FusedChecksumsPolicy {
+        typedef uint64_t HashType;
+
+        static inline HashType Hash(const void* const aValue, const size_t aBytes) throw() {
+            const Checksums checksums = MultiChecksum::Hash(aValue, aBytes);
+            return checksums.Crc ^ checksums.Addler ^ checksums.Hash64;
+        }
+    };
+
+    // Registry
+
+    struct Candidate {
+        const char* Name;
+        void(*Speed)(const char*, const Options&, const uint8_t*, size_t, Report&);
+        void(*Avalanche)(const char*, const Options&, Report&);
+        void(*Distribution)(const char*, const std::vector<KeySet>&, Report&);
+    };
+
+    #define SOLAIRE_BENCHMARK_CANDIDATE(aName, aPolicy) {aName, &RunSpeed<aPolicy>, &RunAvalanche<aPolicy>, &RunDistribution<aPolicy>}
+
+    static const Candidate CANDIDATES[] = {
+        SOLAIRE_BENCHMARK_CANDIDATE("HashSum8",     HashSum8::Policy),
+        SOLAIRE_BENCHMARK_CANDIDATE("HashSum16",    HashSum16::Policy),
+        SOLAIRE_BENCHMARK_CANDIDATE("HashSum32",    HashSum32::Policy),
+        SOLAIRE_BENCHMARK_CANDIDATE("HashSum64",    HashSum64::Policy),
+        SOLAIRE_BENCHMARK_CANDIDATE("Djb2",         Djb2::Policy),
+        SOLAIRE_BENCHMARK_CANDIDATE("Sdbm",         Sdbm::Policy),
+        SOLAIRE_BENCHMARK_CANDIDATE("Addler32",     Addler32::Policy),
+        SOLAIRE_BENCHMARK_CANDIDATE("CrcCcitt",     CrcCcitt::Policy),
+        SOLAIRE_BENCHMARK_CANDIDATE("Crc16",        Crc16::Policy),
+        SOLAIRE_BENCHMARK_CANDIDATE("Crc32",        Crc32::Policy),
+        SOLAIRE_BENCHMARK_CANDIDATE("Crc32CTable",  Crc32CTable::Policy),
+        SOLAIRE_BENCHMARK_CANDIDATE("Crc32C",       Crc32C::Policy),
+        SOLAIRE_BENCHMARK_CANDIDATE("MurmurHash3",  MurmurHash3::Policy),
+        SOLAIRE_BENCHMARK_CANDIDATE("WyHash",       WyHash::Policy),
+        SOLAIRE_BENCHMARK_CANDIDATE("XxHash64",     XxHash64::Policy),
+        SOLAIRE_BENCHMARK_CANDIDATE("Xxh3",         Xxh3::Policy),
+        SOLAIRE_BENCHMARK_CANDIDATE("SipHash13",    SipHash13::Policy),
+        SOLAIRE_BENCHMARK_CANDIDATE("SipHash24",    SipHash24::Policy),
+        {"Crc32+Addler32+Xxh3",         &RunSpeed<SeparateChecksumsPolicy>, nullptr, nullptr},
+        {"MultiChecksum",               &RunSpeed<FusedChecksumsPolicy>,    nullptr, nullptr}
+    };
+
+    #undef SOLAIRE_BENCHMARK_CANDIDATE
+
+    static bool ParseOptions(const int aCount, char** const aArguments, Options& aOptions) {
+        for(int i = 1; i < aCount; ++i) {
+            const std::string argument = aArguments[i];
+            const size_t equals = argument.find('=');
+            const std::string name = argument.substr(0, equals);
+            const std::string value = equals == std::string::npos ? std::string() : argument.substr(equals + 1);
+
+            if(name == "--format" && (value == "csv" || value == "json")) {
+                aOptions.OutputFormat = value == "csv" ? FORMAT_CSV : FORMAT_JSON;
+            }else if(name == "--filter") {
+                aOptions.Filter = value;
+            }else if(name == "--max-size" && ! value.empty()) {
+                aOptions.MaxSize = static_cast<size_t>(std::strtoull(value.c_str(), nullptr, 10));
+            }else if(name == "--min-time" && ! value.empty()) {
+                aOptions.MinTime = std::strtod(value.c_str(), nullptr);
+            }else if(name == "--keys" && ! value.empty()) {
+                aOptions.Keys = static_cast<size_t>(std::strtoull(value.c_str(), nullptr, 10));
+            }else if(name == "--trials" && ! value.empty()) {
+                aOptions.Trials = std::max<size_t>(1, static_cast<size_t>(std::strtoull(value.c_str(), nullptr, 10)));
+            }else if(argument == "--no-speed") {
+                aOptions.Speed = false;
+            }else if(argument == "--no-quality") {
+                aOptions.Quality = false;
+            }else {
+                std::fprintf(stderr, "Unknown option '%s'\n", argument.c_str());
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main(int aCount, char** aArguments) {
+    Options options;
+    if(! ParseOptions(aCount, aArguments, options)) {
+        std::fprintf(stderr,
+            "Usage : HashBenchmark [--format=csv|json] [--filter=NAME] [--max-size=BYTES] [--min-time=SECONDS]\n"
+            "                      [--keys=COUNT] [--trials=COUNT] [--no-speed] [--no-quality]\n"
+        );
+        return 1;
+    }
+
+    // One buffer serves every speed test, it is halved until the allocation succeeds
+    std::vector<uint8_t> data;
+    if(options.Speed) {
+        size_t bytes = options.MaxSize + 64;
+        while(data.empty() && bytes > 64) {
+            try{
+                data.resize(bytes);
+            }catch(std::bad_alloc&) {
+                bytes /= 2;
+            }
+        }
+        FillRandom(data.data(), data.size(), 0xB17E5);
+    }
+
+    std::vector<KeySet> keySets;
+    if(options.Quality) keySets = MakeKeySets(options.Keys);
+
+    Report report(options.OutputFormat);
+    for(const Candidate& candidate : CANDIDATES) {
+        if(! options.Filter.empty() && std::string(candidate.Name).find(options.Filter) == std::string::npos) continue;
+
+        if(options.Speed) candidate.Speed(candidate.Name, options, data.data(), data.size(), report);
+        if(options.Quality && candidate.Avalanche != nullptr) {
+            candidate.Avalanche(candidate.Name, options, report);
+            candidate.Distribution(candidate.Name, keySets, report);
+        }
+    }
+
+    return 0;
+}
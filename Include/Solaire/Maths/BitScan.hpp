@@ -0,0 +1,139 @@
+#ifndef SOLAIRE_BIT_SCAN_HPP
+#define SOLAIRE_BIT_SCAN_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file BitScan.hpp
+	\brief Leading and trailing zero counts.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 16th October 2026
+	Last Modified	: 16th October 2026
+*/
+
+#include <cstdint>
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+namespace Solaire{
+
+    namespace Implementation{
+        static constexpr uint8_t NYBBLE_LEADING_ZEROS[16]{
+            4,	3,	2,	2,	1,	1,	1,	1,
+            0,	0,	0,	0,	0,	0,	0,	0
+        };
+    }
+
+	// Compile time forms, a value of 0 returns the width of the type
+
+	static constexpr uint8_t countLeadingZeros4(const uint8_t aValue) throw() {
+		return Implementation::NYBBLE_LEADING_ZEROS[aValue];
+	}
+
+	static constexpr uint8_t countLeadingZeros8(const uint8_t aValue) throw() {
+		return (aValue >> 4) == 0 ?
+			4 + countLeadingZeros4(aValue & 0xF) :
+			countLeadingZeros4(aValue >> 4);
+	}
+
+	static constexpr uint8_t countLeadingZeros16(const uint16_t aValue) throw() {
+		return (aValue >> 8) == 0 ?
+			8 + countLeadingZeros8(aValue & 0xFF) :
+			countLeadingZeros8(aValue >> 8);
+	}
+
+	static constexpr uint8_t countLeadingZeros32(const uint32_t aValue) throw() {
+		return (aValue >> 16) == 0 ?
+			16 + countLeadingZeros16(aValue & 0xFFFF) :
+			countLeadingZeros16(aValue >> 16);
+	}
+
+	static constexpr uint8_t countLeadingZeros64(const uint64_t aValue) throw() {
+		return (aValue >> 32) == 0 ?
+			32 + countLeadingZeros32(aValue & 0xFFFFFFFF) :
+			countLeadingZeros32(aValue >> 32);
+	}
+
+	static constexpr uint8_t countTrailingZeros32(const uint32_t aValue) throw() {
+		return aValue == 0 ? 32 : 31 - countLeadingZeros32(aValue & (~aValue + 1));
+	}
+
+	static constexpr uint8_t countTrailingZeros64(const uint64_t aValue) throw() {
+		return aValue == 0 ? 64 : 63 - countLeadingZeros64(aValue & (~aValue + 1));
+	}
+
+	// Run time forms that use the processor's bit scan instructions, the value must not be 0
+
+	static inline uint32_t scanLeadingZeros32(const uint32_t aValue) throw() {
+#if defined(__GNUC__)
+		return static_cast<uint32_t>(__builtin_clz(aValue));
+#elif defined(_MSC_VER)
+		unsigned long index;
+		_BitScanReverse(&index, aValue);
+		return 31 - static_cast<uint32_t>(index);
+#else
+		return countLeadingZeros32(aValue);
+#endif
+	}
+
+	static inline uint32_t scanLeadingZeros64(const uint64_t aValue) throw() {
+#if defined(__GNUC__)
+		return static_cast<uint32_t>(__builtin_clzll(aValue));
+#elif defined(_MSC_VER) && defined(_M_X64)
+		unsigned long index;
+		_BitScanReverse64(&index, aValue);
+		return 63 - static_cast<uint32_t>(index);
+#else
+		return countLeadingZeros64(aValue);
+#endif
+	}
+
+	static inline uint32_t scanTrailingZeros32(const uint32_t aValue) throw() {
+#if defined(__GNUC__)
+		return static_cast<uint32_t>(__builtin_ctz(aValue));
+#elif defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward(&index, aValue);
+		return static_cast<uint32_t>(index);
+#else
+		return countTrailingZeros32(aValue);
+#endif
+	}
+
+	static inline uint32_t scanTrailingZeros64(const uint64_t aValue) throw() {
+#if defined(__GNUC__)
+		return static_cast<uint32_t>(__builtin_ctzll(aValue));
+#elif defined(_MSC_VER) && defined(_M_X64)
+		unsigned long index;
+		_BitScanForward64(&index, aValue);
+		return static_cast<uint32_t>(index);
+#else
+		return countTrailingZeros64(aValue);
+#endif
+	}
+}
+
+
+#endif
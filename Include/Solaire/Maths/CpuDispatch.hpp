@@ -0,0 +1,134 @@
+#ifndef SOLAIRE_CPU_DISPATCH_HPP
+#define SOLAIRE_CPU_DISPATCH_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file CpuDispatch.hpp
+	\brief Runtime CPU feature detection and selection of the fastest kernel for each operation.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 16th October 2026
+	Last Modified	: 16th October 2026
+*/
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define SOLAIRE_CPU_X64 1
+#else
+    #define SOLAIRE_CPU_X64 0
+#endif
+
+/*!
+    \def SOLAIRE_RUNTIME_DISPATCH
+    \brief 1 if kernels for instruction sets that the compiler was not told to target are built and selected at runtime.
+    \def SOLAIRE_TARGET
+    \brief Allows a function to use an instruction set that the rest of the translation unit does not target.
+*/
+#if SOLAIRE_CPU_X64 && (defined(__GNUC__) || defined(__clang__))
+    #define SOLAIRE_RUNTIME_DISPATCH 1
+    #define SOLAIRE_TARGET(aFeatures) __attribute__((target(aFeatures)))
+#elif SOLAIRE_CPU_X64 && defined(_MSC_VER)
+    #define SOLAIRE_RUNTIME_DISPATCH 1
+    #define SOLAIRE_TARGET(aFeatures)
+#else
+    #define SOLAIRE_RUNTIME_DISPATCH 0
+    #define SOLAIRE_TARGET(aFeatures)
+#endif
+
+namespace Solaire{
+
+    enum CpuFeature : uint32_t {
+        CPU_SSE2        = 1 << 0,
+        CPU_SSSE3       = 1 << 1,
+        CPU_SSE4_2      = 1 << 2,
+        CPU_PCLMUL      = 1 << 3,
+        CPU_POPCNT      = 1 << 4,
+        CPU_AVX2        = 1 << 5,
+        CPU_BMI2        = 1 << 6,
+        CPU_AVX512F     = 1 << 7,
+        CPU_AVX512BW    = 1 << 8,
+        CPU_SHA         = 1 << 9,
+        CPU_FEATURE_COUNT = 10
+    };
+
+    /*!
+        \brief Query the processor with cpuid.
+        \details AVX2 and AVX-512 are only reported if the operating system saves their registers.
+        \return A combination of CpuFeature flags, 0 on processors that are not x86-64.
+    */
+    uint32_t detectCpuFeatures() throw();
+
+    /*!
+        \brief The features that kernels are selected for, detected once when first called.
+        \details
+        If the environment variable SOLAIRE_CPU_FEATURES is set it limits the features to the comma separated names that
+        it lists, for example "sse2,ssse3" or "none" to test the portable kernels. Features that the processor does not
+        have are never enabled.
+    */
+    uint32_t getCpuFeatures() throw();
+
+    static inline bool hasCpuFeatures(const uint32_t aFeatures) throw() {
+        return (getCpuFeatures() & aFeatures) == aFeatures;
+    }
+
+    /*!
+        \brief The name of a single feature as used by SOLAIRE_CPU_FEATURES, or nullptr if aFeature is not one flag.
+    */
+    const char* getCpuFeatureName(const uint32_t aFeature) throw();
+
+    /*!
+        \brief Convert a list of feature names, separated by commas or spaces, into CpuFeature flags.
+        \details Unknown names are ignored.
+    */
+    uint32_t parseCpuFeatures(const char* const aNames) throw();
+
+    /*!
+        \brief The kernels used by popCount, reflect, binaryToHex, hexToBinary, Base64 and Crc.
+        \details The kernels do not check buffer sizes, the public functions do that before calling them.
+    */
+    struct MathsKernels {
+        uint32_t (*popCount)(const void* aSrc, uint32_t aBytes);                                                            //!< See popCount.
+        void (*reflect)(void* aDst, const void* aSrc, uint32_t aBytes);                                                     //!< See reflect.
+        void (*binaryToHex)(const void* aBinary, uint32_t aBinaryLength, char* aHex);                                       //!< Writes 2 * aBinaryLength characters.
+        void (*hexToBinary)(const char* aHex, uint32_t aHexLength, uint8_t* aBinaryEnd);                                    //!< Writes backwards from aBinaryEnd - 1.
+        char* (*base64Encode)(char* aOutput, const uint8_t* aInput, uint32_t aInputLength, const char* aBase64, const char* aPadding);
+        char* (*base64Decode)(char* aOutput, const char* aInput, uint32_t aInputLength, const char* aBase64);               //!< aInputLength is a multiple of 4 with no padding characters.
+        uint32_t (*crc32c)(uint32_t aRemainder, const void* aValue, size_t aBytes);                                         //!< See Crc32C::UpdateRemainder.
+        const char* names[7];                                                                                               //!< The instruction set of each kernel, in member order.
+    };
+
+    /*!
+        \brief Choose the fastest kernels that only use aFeatures.
+        \details Useful for testing and benchmarking each kernel, normal code should use getMathsKernels.
+    */
+    MathsKernels selectMathsKernels(const uint32_t aFeatures) throw();
+
+    /*!
+        \brief The kernels for getCpuFeatures, selected once when first called.
+    */
+    const MathsKernels& getMathsKernels() throw();
+}
+
+#endif
@@ -28,32 +28,337 @@ Last modified	: Adam Smith
 \version 1.0
 \date
 Created			: 1st October 2015
-Last Modified	: 1st October 2015
+Last Modified	: 16th October 2026
 */
 
+#include <algorithm>
+#include <vector>
 #include "HashFunction.hpp"
 
+#if defined(__AVX2__)
+    #define SOLAIRE_ADDLER_AVX2 1
+    #define SOLAIRE_ADDLER_SSSE3 0
+    #include <immintrin.h>
+#elif defined(__SSSE3__) || (defined(_MSC_VER) && defined(__AVX__))
+    #define SOLAIRE_ADDLER_AVX2 0
+    #define SOLAIRE_ADDLER_SSSE3 1
+    #include <tmmintrin.h>
+#else
+    #define SOLAIRE_ADDLER_AVX2 0
+    #define SOLAIRE_ADDLER_SSSE3 0
+#endif
+
 namespace Solaire{
 
+    /*!
+        \brief Adler-32 checksum.
+        \details
+        The modulo is only taken once every NMAX bytes, the largest number of bytes that can be added without s2 overflowing.
+        When SSSE3 or AVX2 is available s1 and s2 are calculated for 32 or 64 bytes at a time with pmaddubsw.
+    */
     template<class T, typename Enable = typename std::enable_if<std::is_same<T, uint32_t>::value, void>::type>
     class Addler : public HashFunction<uint32_t>
     {
+    private:
+        enum : uint32_t{
+            BASE = 65521,   //!< The largest prime smaller than 2^16
+            NMAX = 5552     //!< The largest n such that 255n(n+1)/2 + (n+1)(BASE-1) <= 2^32-1
+        };
+
+        static void UpdateScalar(uint32_t& aS1, uint32_t& aS2, const uint8_t* aData, size_t aBytes) throw() {
+            uint32_t s1 = aS1;
+            uint32_t s2 = aS2;
+
+            while(aBytes > 0) {
+                size_t count = aBytes < NMAX ? aBytes : static_cast<size_t>(NMAX);
+                aBytes -= count;
+
+                while(count >= 8) {
+                    s1 += aData[0]; s2 += s1;
+                    s1 += aData[1]; s2 += s1;
+                    s1 += aData[2]; s2 += s1;
+                    s1 += aData[3]; s2 += s1;
+                    s1 += aData[4]; s2 += s1;
+                    s1 += aData[5]; s2 += s1;
+                    s1 += aData[6]; s2 += s1;
+                    s1 += aData[7]; s2 += s1;
+                    aData += 8;
+                    count -= 8;
+                }
+
+                while(count > 0) {
+                    s1 += *(aData++);
+                    s2 += s1;
+                    --count;
+                }
+
+                s1 %= BASE;
+                s2 %= BASE;
+            }
+
+            aS1 = s1;
+            aS2 = s2;
+        }
+
+#if SOLAIRE_ADDLER_SSSE3
+        enum : uint32_t{
+            BLOCK_SIZE = 32
+        };
+
+        static uint32_t HorizontalSum(const __m128i aValue) throw() {
+            __m128i sum = _mm_add_epi32(aValue, _mm_shuffle_epi32(aValue, _MM_SHUFFLE(1, 0, 3, 2)));
+            sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+            return static_cast<uint32_t>(_mm_cvtsi128_si32(sum));
+        }
+
+        static void UpdateBlocks(uint32_t& aS1, uint32_t& aS2, const uint8_t* aData, size_t aBlocks) throw() {
+            const __m128i tap1 = _mm_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17);
+            const __m128i tap2 = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i ones = _mm_set1_epi16(1);
+
+            // Every block adds BLOCK_SIZE * s1 to s2, the sum of s1 at the start of each block is held in previousS1
+            __m128i previousS1 = _mm_cvtsi32_si128(static_cast<int>(aS1 * aBlocks));
+            __m128i s1 = zero;
+            __m128i s2 = _mm_cvtsi32_si128(static_cast<int>(aS2));
+
+            while(aBlocks > 0) {
+                const __m128i bytes1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(aData));
+                const __m128i bytes2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(aData + 16));
+
+                previousS1 = _mm_add_epi32(previousS1, s1);
+                s1 = _mm_add_epi32(s1, _mm_add_epi32(_mm_sad_epu8(bytes1, zero), _mm_sad_epu8(bytes2, zero)));
+                s2 = _mm_add_epi32(s2, _mm_add_epi32(
+                    _mm_madd_epi16(_mm_maddubs_epi16(bytes1, tap1), ones),
+                    _mm_madd_epi16(_mm_maddubs_epi16(bytes2, tap2), ones)
+                ));
+
+                aData += BLOCK_SIZE;
+                --aBlocks;
+            }
+
+            s2 = _mm_add_epi32(s2, _mm_slli_epi32(previousS1, 5));
+
+            aS1 = (aS1 + HorizontalSum(s1)) % BASE;
+            aS2 = HorizontalSum(s2) % BASE;
+        }
+#elif SOLAIRE_ADDLER_AVX2
+        enum : uint32_t{
+            BLOCK_SIZE = 64
+        };
+
+        static uint32_t HorizontalSum(const __m256i aValue) throw() {
+            __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(aValue), _mm256_extracti128_si256(aValue, 1));
+            sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+            sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+            return static_cast<uint32_t>(_mm_cvtsi128_si32(sum));
+        }
+
+        static void UpdateBlocks(uint32_t& aS1, uint32_t& aS2, const uint8_t* aData, size_t aBlocks) throw() {
+            const __m256i tap1 = _mm256_setr_epi8(
+                64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49,
+                48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33
+            );
+            const __m256i tap2 = _mm256_setr_epi8(
+                32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+                16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1
+            );
+            const __m256i zero = _mm256_setzero_si256();
+            const __m256i ones = _mm256_set1_epi16(1);
+
+            // Every block adds BLOCK_SIZE * s1 to s2, the sum of s1 at the start of each block is held in previousS1
+            __m256i previousS1 = _mm256_setr_epi32(static_cast<int>(aS1 * aBlocks), 0, 0, 0, 0, 0, 0, 0);
+            __m256i s1 = zero;
+            __m256i s2 = _mm256_setr_epi32(static_cast<int>(aS2), 0, 0, 0, 0, 0, 0, 0);
+
+            while(aBlocks > 0) {
+                const __m256i bytes1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(aData));
+                const __m256i bytes2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(aData + 32));
+
+                previousS1 = _mm256_add_epi32(previousS1, s1);
+                s1 = _mm256_add_epi32(s1, _mm256_add_epi32(_mm256_sad_epu8(bytes1, zero), _mm256_sad_epu8(bytes2, zero)));
+                s2 = _mm256_add_epi32(s2, _mm256_add_epi32(
+                    _mm256_madd_epi16(_mm256_maddubs_epi16(bytes1, tap1), ones),
+                    _mm256_madd_epi16(_mm256_maddubs_epi16(bytes2, tap2), ones)
+                ));
+
+                aData += BLOCK_SIZE;
+                --aBlocks;
+            }
+
+            s2 = _mm256_add_epi32(s2, _mm256_slli_epi32(previousS1, 6));
+
+            aS1 = (aS1 + HorizontalSum(s1)) % BASE;
+            aS2 = HorizontalSum(s2) % BASE;
+        }
+#endif
+
+        static void Update(uint32_t& aS1, uint32_t& aS2, const uint8_t* aData, size_t aBytes) throw() {
+#if SOLAIRE_ADDLER_SSSE3 || SOLAIRE_ADDLER_AVX2
+            while(aBytes >= BLOCK_SIZE) {
+                const size_t blocks = (aBytes < NMAX ? aBytes : static_cast<size_t>(NMAX)) / BLOCK_SIZE;
+                UpdateBlocks(aS1, aS2, aData, blocks);
+                aData += blocks * BLOCK_SIZE;
+                aBytes -= blocks * BLOCK_SIZE;
+            }
+#endif
+            UpdateScalar(aS1, aS2, aData, aBytes);
+        }
+    public:
+        /*!
+            \brief Static form of Addler that can be inlined, see HashFunctionAdapter.
+        */
+        struct Policy {
+            typedef uint32_t HashType;
+
+            static inline HashType Hash(const void* const aValue, const size_t aBytes) throw() {
+                uint32_t s1 = 1;
+                uint32_t s2 = 0;
+                Addler::Update(s1, s2, static_cast<const uint8_t*>(aValue), aBytes);
+                return (s2 << 16) | s1;
+            }
+        };
+
+        class State : public HashState<uint32_t> {
+        private:
+            HashType mS1;
+            HashType mS2;
+        public:
+            State() throw() :
+                mS1(1),
+                mS2(0)
+            {}
+
+            SOLAIRE_EXPORT_CALL ~State() throw() {
+
+            }
+
+            // Inherited from HashState
+
+            void SOLAIRE_EXPORT_CALL Initialise() throw() override {
+                mS1 = 1;
+                mS2 = 0;
+            }
+
+            void SOLAIRE_EXPORT_CALL Update(const void* const aValue, const size_t aBytes) throw() override {
+                Addler::Update(mS1, mS2, static_cast<const uint8_t*>(aValue), aBytes);
+            }
+
+            HashType SOLAIRE_EXPORT_CALL Finalise() const throw() override {
+                return (mS2 << 16) | mS1;
+            }
+        };
     public:
         // Inherited from HashFunction
         HashType SOLAIRE_EXPORT_CALL Hash(const void* const aValue, const size_t aBytes) const throw() override{
-			const uint8_t* const data = static_cast<const uint8_t*>(aValue);
-			HashType s1 = 1;
-			HashType s2 = 0;
-
-			for(size_t i = 0; i < aBytes; ++i){
-				s1 = (s1 + data[i]) % 65521;
-				s2 = (s2 + s1) % 65521;
-			}
-			return (s2 << 16) | s1;
+            return Policy::Hash(aValue, aBytes);
         }
     };
 
     typedef Addler<uint32_t> Addler32;
+
+    /*!
+        \brief Adler-32 of a fixed size window that can be moved through data one byte at a time.
+        \details The hash of each window is the same as the Addler32 hash of the bytes in the window.
+    */
+    class RollingAddler32 {
+    private:
+        enum : uint32_t{
+            BASE = 65521
+        };
+    private:
+        uint32_t mOutWeights[256];  //!< (window * byte) % BASE for every byte value
+        uint32_t mWindow;
+        uint32_t mS1;
+        uint32_t mS2;
+    public:
+        RollingAddler32(const uint32_t aWindow) throw() :
+            mWindow(aWindow),
+            mS1(1),
+            mS2(0)
+        {
+            const uint32_t window = aWindow % BASE;
+            for(uint32_t i = 0; i < 256; ++i) mOutWeights[i] = (window * i) % BASE;
+        }
+
+        /*!
+            \brief Hash the first window of data.
+            \param aValue The address of the window, which must contain at least GetWindow() bytes.
+        */
+        void Initialise(const void* const aValue) throw() {
+            Addler32::State state;
+            state.Update(aValue, mWindow);
+            const uint32_t hash = state.Finalise();
+            mS1 = hash & 0xFFFF;
+            mS2 = hash >> 16;
+        }
+
+        /*!
+            \brief Move the window forward by one byte.
+            \param aOut The first byte of the current window.
+            \param aIn The byte after the end of the current window.
+        */
+        void Roll(const uint8_t aOut, const uint8_t aIn) throw() {
+            int32_t s1 = static_cast<int32_t>(mS1) + aIn - aOut;
+            if(s1 < 0) s1 += BASE;
+            else if(s1 >= static_cast<int32_t>(BASE)) s1 -= BASE;
+
+            int32_t s2 = static_cast<int32_t>(mS2) - static_cast<int32_t>(mOutWeights[aOut]) + s1 - 1;
+            if(s2 < 0) s2 += BASE;
+            else if(s2 >= static_cast<int32_t>(BASE)) s2 -= BASE;
+
+            mS1 = static_cast<uint32_t>(s1);
+            mS2 = static_cast<uint32_t>(s2);
+        }
+
+        uint32_t GetHash() const throw() {
+            return (mS2 << 16) | mS1;
+        }
+
+        uint32_t GetWindow() const throw() {
+            return mWindow;
+        }
+
+        /*!
+            \brief Find every window of data whose hash is in a set of hashes.
+            \param aValue The address of the data.
+            \param aBytes The number of bytes of data.
+            \param aWindow The size of the window in bytes.
+            \param aHashes The hashes to search for.
+            \param aHashCount The number of hashes.
+            \param aCallback Called as aCallback(offset, hash) for each match, scanning stops if it returns false.
+        */
+        template<class CALLBACK>
+        static void Scan(const void* const aValue, const size_t aBytes, const uint32_t aWindow, const uint32_t* const aHashes, const size_t aHashCount, CALLBACK aCallback) {
+            if(aWindow == 0 || aBytes < aWindow || aHashCount == 0) return;
+
+            // Most windows are rejected by a 64K bit filter before searching the sorted hashes
+            std::vector<uint32_t> hashes(aHashes, aHashes + aHashCount);
+            std::sort(hashes.begin(), hashes.end());
+            std::vector<uint64_t> filter(65536 / 64, 0);
+            for(const uint32_t hash : hashes) {
+                const uint32_t key = (hash ^ (hash >> 16)) & 0xFFFF;
+                filter[key >> 6] |= static_cast<uint64_t>(1) << (key & 63);
+            }
+
+            const uint8_t* const data = static_cast<const uint8_t*>(aValue);
+            const size_t last = aBytes - aWindow;
+            RollingAddler32 rolling(aWindow);
+            rolling.Initialise(data);
+
+            for(size_t i = 0;; ++i) {
+                const uint32_t hash = rolling.GetHash();
+                const uint32_t key = (hash ^ (hash >> 16)) & 0xFFFF;
+                if((filter[key >> 6] >> (key & 63)) & 1) {
+                    if(std::binary_search(hashes.begin(), hashes.end(), hash)) {
+                        if(! aCallback(i, hash)) return;
+                    }
+                }
+                if(i == last) return;
+                rolling.Roll(data[i], data[i + aWindow]);
+            }
+        }
+    };
 }
 
 #endif
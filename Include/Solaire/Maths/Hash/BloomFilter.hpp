@@ -0,0 +1,352 @@
+#ifndef SOLAIRE_HASH_BLOOM_FILTER_HPP
+#define SOLAIRE_HASH_BLOOM_FILTER_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file BloomFilter.hpp
+	\brief A Bloom filter that touches one cache line per key.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 16th October 2026
+	Last Modified	: 16th October 2026
+*/
+
+#include <cmath>
+#include <cstring>
+#include <new>
+#include "HashKey.hpp"
+#include "HashUtility.hpp"
+#include "WyHash.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #define SOLAIRE_BLOOM_FILTER_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define SOLAIRE_BLOOM_FILTER_SSE2 0
+#endif
+
+#if defined(__AVX2__)
+    #define SOLAIRE_BLOOM_FILTER_AVX2 1
+    #include <immintrin.h>
+#else
+    #define SOLAIRE_BLOOM_FILTER_AVX2 0
+#endif
+
+namespace Solaire{
+
+    namespace BloomFilterImplementation {
+
+        enum : size_t {
+            BLOCK_SIZE = 64,
+            BLOCK_WORDS = BLOCK_SIZE / sizeof(uint64_t)
+        };
+
+        // Odd multipliers that turn the low 32 bits of a hash into one bit index per word
+        static constexpr uint32_t SALTS[BLOCK_WORDS] = {
+            0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+            0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U
+        };
+
+        /*!
+            \brief Calculate the bits a hash sets in its block, one in each 64 bit word.
+        */
+        static inline void MakeMask(const uint64_t aHash, uint64_t* const aMask) throw() {
+            const uint32_t hash = static_cast<uint32_t>(aHash);
+            for(size_t i = 0; i < BLOCK_WORDS; ++i) {
+                aMask[i] = static_cast<uint64_t>(1) << ((hash * SALTS[i]) >> 26);
+            }
+        }
+
+#if SOLAIRE_BLOOM_FILTER_AVX2
+        static inline void MakeMask(const uint64_t aHash, __m256i& aLow, __m256i& aHigh) throw() {
+            // Multiply the low 32 bits of each 64 bit lane, then keep the top 6 bits of the 32 bit product
+            const __m256i hash = _mm256_set1_epi64x(static_cast<int64_t>(static_cast<uint32_t>(aHash)));
+            const __m256i one = _mm256_set1_epi64x(1);
+            const __m256i low = _mm256_mul_epu32(hash, _mm256_setr_epi64x(SALTS[0], SALTS[1], SALTS[2], SALTS[3]));
+            const __m256i high = _mm256_mul_epu32(hash, _mm256_setr_epi64x(SALTS[4], SALTS[5], SALTS[6], SALTS[7]));
+            aLow = _mm256_sllv_epi64(one, _mm256_srli_epi64(_mm256_slli_epi64(low, 32), 58));
+            aHigh = _mm256_sllv_epi64(one, _mm256_srli_epi64(_mm256_slli_epi64(high, 32), 58));
+        }
+#endif
+    }
+
+    /*!
+        \brief A Bloom filter split into 64 byte blocks, each key only reads or writes the block selected by its hash.
+        \details
+        A key sets 8 bits in its block, one in each 64 bit word, all derived from a single 64 bit hash. The high bits
+        of the hash select the block and the low 32 bits select the bits. Queries are therefore a single cache miss,
+        at the cost of a slightly higher false positive rate than an unblocked filter of the same size,
+        see FalsePositiveRate and BytesFor.
+        \tparam KEY The key type, keys of other types are converted to it before they are hashed, see HashKeyLookup.
+        \tparam POLICY A 64 bit hash policy, see HashFunctionAdapter.
+    */
+    template<class KEY = uint64_t, class POLICY = WyHash::Policy>
+    class BlockedBloomFilter {
+    public:
+        static_assert(sizeof(typename POLICY::HashType) == sizeof(uint64_t), "BlockedBloomFilter requires a 64 bit hash");
+
+        enum : size_t {
+            BLOCK_SIZE = BloomFilterImplementation::BLOCK_SIZE,
+            PROBES = BloomFilterImplementation::BLOCK_WORDS,
+            BATCH_SIZE = 16
+        };
+    private:
+        enum : size_t {
+            BLOCK_WORDS = BloomFilterImplementation::BLOCK_WORDS
+        };
+    private:
+        void* mMemory;
+        uint64_t* mBlocks;
+        size_t mBlockCount;
+    private:
+        void Allocate(const size_t aBlockCount) {
+            // Blocks are aligned to a cache line so that each one is a single line
+            mMemory = ::operator new(aBlockCount * BLOCK_SIZE + BLOCK_SIZE - 1);
+            const uintptr_t address = reinterpret_cast<uintptr_t>(mMemory);
+            mBlocks = reinterpret_cast<uint64_t*>((address + BLOCK_SIZE - 1) & ~static_cast<uintptr_t>(BLOCK_SIZE - 1));
+            mBlockCount = aBlockCount;
+        }
+
+        inline uint64_t* BlockOf(const uint64_t aHash) const throw() {
+            uint64_t low, high;
+            HashUtility::Multiply128(aHash, mBlockCount, low, high);
+            return mBlocks + static_cast<size_t>(high) * BLOCK_WORDS;
+        }
+
+        static inline void Prefetch(const void* const aAddress) throw() {
+#if SOLAIRE_BLOOM_FILTER_SSE2
+            _mm_prefetch(static_cast<const char*>(aAddress), _MM_HINT_T0);
+#elif defined(__GNUC__)
+            __builtin_prefetch(aAddress);
+#endif
+        }
+    public:
+        /*!
+            \brief The expected false positive rate after aKeys distinct keys are inserted into a filter of aBytes.
+            \details The number of keys in a block follows a Poisson distribution, the rate is averaged over it.
+        */
+        static double FalsePositiveRate(const size_t aKeys, const size_t aBytes) throw() {
+            if(aKeys == 0) return 0.0;
+            const double blocks = static_cast<double>(aBytes < BLOCK_SIZE ? 1 : aBytes / BLOCK_SIZE);
+            const double mean = static_cast<double>(aKeys) / blocks;
+            const double spread = 10.0 * std::sqrt(mean) + 10.0;
+            const double begin = mean > spread ? std::floor(mean - spread) : 0.0;
+
+            double rate = 0.0;
+            for(double i = begin; i <= mean + spread; i += 1.0) {
+                // The Poisson probability is calculated in log space so that large means do not underflow
+                const double probability = std::exp(i * std::log(mean) - mean - std::lgamma(i + 1.0));
+
+                // i other keys have each set one bit of every word
+                rate += probability * std::pow(1.0 - std::pow(1.0 - 1.0 / 64.0, i), static_cast<double>(PROBES));
+            }
+            return rate;
+        }
+
+        /*!
+            \brief The smallest size that gives a false positive rate of at most aRate after aKeys keys are inserted.
+        */
+        static size_t BytesFor(const size_t aKeys, const double aRate) throw() {
+            size_t low = 1;
+            size_t high = 1;
+            while(FalsePositiveRate(aKeys, high * BLOCK_SIZE) > aRate) {
+                low = high + 1;
+                high *= 2;
+            }
+            while(low < high) {
+                const size_t middle = low + (high - low) / 2;
+                if(FalsePositiveRate(aKeys, middle * BLOCK_SIZE) > aRate) {
+                    low = middle + 1;
+                }else {
+                    high = middle;
+                }
+            }
+            return high * BLOCK_SIZE;
+        }
+
+        /*!
+            \brief Create an empty filter.
+            \param aBytes The size of the filter, rounded up to a whole number of 64 byte blocks.
+        */
+        explicit BlockedBloomFilter(const size_t aBytes) {
+            Allocate(aBytes < BLOCK_SIZE ? 1 : (aBytes + BLOCK_SIZE - 1) / BLOCK_SIZE);
+            Clear();
+        }
+
+        BlockedBloomFilter(const BlockedBloomFilter& aOther) {
+            Allocate(aOther.mBlockCount);
+            std::memcpy(mBlocks, aOther.mBlocks, mBlockCount * BLOCK_SIZE);
+        }
+
+        BlockedBloomFilter(BlockedBloomFilter&& aOther) throw() :
+            mMemory(aOther.mMemory),
+            mBlocks(aOther.mBlocks),
+            mBlockCount(aOther.mBlockCount)
+        {
+            aOther.mMemory = nullptr;
+            aOther.mBlocks = nullptr;
+            aOther.mBlockCount = 0;
+        }
+
+        ~BlockedBloomFilter() throw() {
+            ::operator delete(mMemory);
+        }
+
+        BlockedBloomFilter& operator=(const BlockedBloomFilter& aOther) {
+            if(this != &aOther) {
+                BlockedBloomFilter tmp(aOther);
+                Swap(tmp);
+            }
+            return *this;
+        }
+
+        BlockedBloomFilter& operator=(BlockedBloomFilter&& aOther) throw() {
+            BlockedBloomFilter tmp(std::move(aOther));
+            Swap(tmp);
+            return *this;
+        }
+
+        void Swap(BlockedBloomFilter& aOther) throw() {
+            std::swap(mMemory, aOther.mMemory);
+            std::swap(mBlocks, aOther.mBlocks);
+            std::swap(mBlockCount, aOther.mBlockCount);
+        }
+
+        size_t Bytes() const throw() {
+            return mBlockCount * BLOCK_SIZE;
+        }
+
+        void Clear() throw() {
+            std::memset(mBlocks, 0, mBlockCount * BLOCK_SIZE);
+        }
+
+        /*!
+            \brief Add the keys of another filter to this one.
+            \return False if the filters are not the same size, in which case this filter is unchanged.
+        */
+        bool Merge(const BlockedBloomFilter& aOther) throw() {
+            if(aOther.mBlockCount != mBlockCount) return false;
+            for(size_t i = 0; i < mBlockCount * BLOCK_WORDS; ++i) mBlocks[i] |= aOther.mBlocks[i];
+            return true;
+        }
+
+        // Hashes
+
+        void InsertHash(const uint64_t aHash) throw() {
+            uint64_t* const block = BlockOf(aHash);
+#if SOLAIRE_BLOOM_FILTER_AVX2
+            __m256i low, high;
+            BloomFilterImplementation::MakeMask(aHash, low, high);
+            __m256i* const words = reinterpret_cast<__m256i*>(block);
+            _mm256_store_si256(words, _mm256_or_si256(_mm256_load_si256(words), low));
+            _mm256_store_si256(words + 1, _mm256_or_si256(_mm256_load_si256(words + 1), high));
+#else
+            uint64_t mask[BLOCK_WORDS];
+            BloomFilterImplementation::MakeMask(aHash, mask);
+            for(size_t i = 0; i < BLOCK_WORDS; ++i) block[i] |= mask[i];
+#endif
+        }
+
+        bool MayContainHash(const uint64_t aHash) const throw() {
+            const uint64_t* const block = BlockOf(aHash);
+#if SOLAIRE_BLOOM_FILTER_AVX2
+            __m256i low, high;
+            BloomFilterImplementation::MakeMask(aHash, low, high);
+            const __m256i* const words = reinterpret_cast<const __m256i*>(block);
+            return _mm256_testc_si256(_mm256_load_si256(words), low) & _mm256_testc_si256(_mm256_load_si256(words + 1), high);
+#elif SOLAIRE_BLOOM_FILTER_SSE2
+            uint64_t mask[BLOCK_WORDS];
+            BloomFilterImplementation::MakeMask(aHash, mask);
+            const __m128i* const words = reinterpret_cast<const __m128i*>(block);
+            const __m128i* const masks = reinterpret_cast<const __m128i*>(mask);
+            __m128i missing = _mm_setzero_si128();
+            for(size_t i = 0; i < BLOCK_WORDS / 2; ++i) {
+                missing = _mm_or_si128(missing, _mm_andnot_si128(_mm_load_si128(words + i), _mm_loadu_si128(masks + i)));
+            }
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(missing, _mm_setzero_si128())) == 0xFFFF;
+#else
+            uint64_t mask[BLOCK_WORDS];
+            BloomFilterImplementation::MakeMask(aHash, mask);
+            uint64_t missing = 0;
+            for(size_t i = 0; i < BLOCK_WORDS; ++i) missing |= mask[i] & ~block[i];
+            return missing == 0;
+#endif
+        }
+
+        // Keys
+
+        /*!
+            \brief Add a key, see HashKeyBytes.
+        */
+        template<class K>
+        void Insert(const K& aKey) {
+            InsertHash(static_cast<uint64_t>(HashKeyAs<POLICY, KEY>(aKey)));
+        }
+
+        /*!
+            \brief Check if a key may have been added.
+            \return False if the key was definitely never added.
+        */
+        template<class K>
+        bool MayContain(const K& aKey) const {
+            return MayContainHash(static_cast<uint64_t>(HashKeyAs<POLICY, KEY>(aKey)));
+        }
+
+        /*!
+            \brief Add many keys, the blocks of 16 keys are prefetched before any are written.
+        */
+        template<class K>
+        void InsertBatch(const K* const aKeys, const size_t aCount) {
+            uint64_t hashes[BATCH_SIZE];
+            for(size_t begin = 0; begin < aCount; begin += BATCH_SIZE) {
+                const size_t count = aCount - begin < BATCH_SIZE ? aCount - begin : BATCH_SIZE;
+                for(size_t i = 0; i < count; ++i) {
+                    hashes[i] = static_cast<uint64_t>(HashKeyAs<POLICY, KEY>(aKeys[begin + i]));
+                    Prefetch(BlockOf(hashes[i]));
+                }
+                for(size_t i = 0; i < count; ++i) InsertHash(hashes[i]);
+            }
+        }
+
+        /*!
+            \brief Check many keys, the blocks of 16 keys are prefetched before any are tested.
+            \param aKeys The keys to check.
+            \param aCount The number of keys.
+            \param aResults Receives the result of MayContain for each key.
+        */
+        template<class K>
+        void MayContainBatch(const K* const aKeys, const size_t aCount, bool* const aResults) const {
+            uint64_t hashes[BATCH_SIZE];
+            for(size_t begin = 0; begin < aCount; begin += BATCH_SIZE) {
+                const size_t count = aCount - begin < BATCH_SIZE ? aCount - begin : BATCH_SIZE;
+                for(size_t i = 0; i < count; ++i) {
+                    hashes[i] = static_cast<uint64_t>(HashKeyAs<POLICY, KEY>(aKeys[begin + i]));
+                    Prefetch(BlockOf(hashes[i]));
+                }
+                for(size_t i = 0; i < count; ++i) aResults[begin + i] = MayContainHash(hashes[i]);
+            }
+        }
+    };
+}
+
+#endif
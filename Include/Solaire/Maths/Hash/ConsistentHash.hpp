@@ -0,0 +1,120 @@
+#ifndef SOLAIRE_HASH_CONSISTENT_HASH_HPP
+#define SOLAIRE_HASH_CONSISTENT_HASH_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file ConsistentHash.hpp
+	\brief Map key hashes to nodes so that resizing the cluster only moves a fair share of the keys.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 16th October 2026
+	Last Modified	: 16th October 2026
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Solaire{
+
+    /*!
+        \brief Jump consistent hash (Lamping and Veach).
+        \details
+        Maps a key hash to a bucket in [0, aBuckets) in O(log aBuckets) time with no memory. When the number of buckets
+        grows from n to n + 1, only 1 / (n + 1) of the keys move, all of them to the new bucket. Buckets can only be
+        added or removed at the end, use RendezvousHash when arbitrary nodes can leave.
+        \param aKey The 64 bit hash of the key.
+        \param aBuckets The number of buckets, at least 1.
+    */
+    uint32_t JumpConsistentHash(uint64_t aKey, const uint32_t aBuckets) throw();
+
+    /*!
+        \brief JumpConsistentHash of many keys.
+        \details Keys are processed 4 at a time so that the divisions of different keys overlap.
+    */
+    void JumpConsistentHashBatch(const uint64_t* const aKeys, const size_t aCount, const uint32_t aBuckets, uint32_t* const aResults) throw();
+
+    /*!
+        \brief Weighted rendezvous (highest random weight) hashing.
+        \details
+        Each node scores every key with weight / -ln(u), where u is a uniform value from the key hash and the node's id,
+        and the key goes to the node with the highest score. A node receives a share of the keys proportional to its
+        weight, and adding or removing a node only moves the keys that it gains or held. Nodes are identified by a
+        stable 64 bit id, such as a hash of their address, so the result does not depend on the order they were added.
+
+        Selection is O(nodes) per key. When every weight is equal the logarithm is skipped and the raw scores are
+        compared, which gives the same distribution.
+    */
+    class RendezvousHash {
+    public:
+        enum : uint32_t {
+            NO_NODE = UINT32_MAX
+        };
+    private:
+        std::vector<uint64_t> mIds;
+        std::vector<double> mWeights;
+        bool mUniform;
+    private:
+        void UpdateUniform() throw();
+        double Score(const uint64_t aKey, const uint32_t aNode) const throw();
+    public:
+        RendezvousHash();
+
+        /*!
+            \brief Add a node, or change its weight if it already exists.
+            \param aId The node's stable id.
+            \param aWeight The node's relative capacity, greater than 0.
+            \return The node's index.
+        */
+        uint32_t AddNode(const uint64_t aId, const double aWeight = 1.0);
+
+        /*!
+            \brief Remove a node, the index of the last node changes to the index of the removed node.
+            \return False if there is no node with the id.
+        */
+        bool RemoveNode(const uint64_t aId) throw();
+
+        uint32_t Size() const throw();
+        uint64_t NodeId(const uint32_t aIndex) const throw();
+        double NodeWeight(const uint32_t aIndex) const throw();
+
+        /*!
+            \brief The index of the node that owns a key hash, or NO_NODE if there are no nodes.
+        */
+        uint32_t Select(const uint64_t aKey) const throw();
+
+        /*!
+            \brief The aCount highest scoring nodes for a key hash, in decreasing order, for placing replicas.
+            \return The number of nodes written, the smaller of aCount and Size().
+        */
+        uint32_t SelectReplicas(const uint64_t aKey, const uint32_t aCount, uint32_t* const aNodes) const;
+
+        /*!
+            \brief Select of many keys.
+            \details Nodes are visited in the outer loop over blocks of keys, so each node's id and weight are loaded once per block.
+        */
+        void SelectBatch(const uint64_t* const aKeys, const size_t aCount, uint32_t* const aResults) const throw();
+    };
+}
+
+#endif
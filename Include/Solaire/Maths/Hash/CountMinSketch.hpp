@@ -0,0 +1,342 @@
+#ifndef SOLAIRE_HASH_COUNT_MIN_SKETCH_HPP
+#define SOLAIRE_HASH_COUNT_MIN_SKETCH_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file CountMinSketch.hpp
+	\brief Approximate per key counts in fixed memory.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 16th October 2026
+	Last Modified	: 16th October 2026
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "HashKey.hpp"
+#include "HashUtility.hpp"
+#include "WyHash.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #define SOLAIRE_COUNT_MIN_SKETCH_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define SOLAIRE_COUNT_MIN_SKETCH_SSE2 0
+#endif
+
+namespace Solaire{
+
+    /*!
+        \brief Count-Min sketch, an estimate of how many times each key was added that is never too low.
+        \details
+        The sketch is DEPTH rows of WIDTH counters. Each key adds to one counter per row and its estimate is the smallest
+        of those counters. With a width of e / epsilon and a depth of ln(1 / delta) the estimate exceeds the true count by
+        more than epsilon * TotalCount() with probability at most delta, see ForError.
+
+        The row indices come from one 64 bit hash with Kirsch-Mitzenmacher double hashing, row i uses low + i * high
+        where low and high are the two halves of the hash.
+
+        Conservative updates only raise the counters that are below the key's new estimate, which greatly reduces the
+        over-estimation for skewed streams. They must not be mixed with negative updates, which this sketch does not
+        support. Sketches of the same size can be merged, including from their serialised form.
+        \tparam KEY The key type, keys of other types are converted to it before they are hashed, see HashKeyLookup.
+        \tparam POLICY A 64 bit hash policy, see HashFunctionAdapter.
+        \tparam COUNTER The unsigned counter type, counters saturate instead of wrapping.
+    */
+    template<class KEY = uint64_t, class POLICY = WyHash::Policy, class COUNTER = uint32_t>
+    class CountMinSketch {
+    public:
+        static_assert(sizeof(typename POLICY::HashType) == sizeof(uint64_t), "Solaire::CountMinSketch : requires a 64 bit hash");
+        static_assert(std::is_unsigned<COUNTER>::value, "Solaire::CountMinSketch : COUNTER must be unsigned");
+
+        typedef COUNTER CounterType;
+
+        enum : uint32_t {
+            MAX_DEPTH = 32,
+            BATCH_SIZE = 16,
+            SERIAL_MAGIC = 0x31534D43,  // "CMS1"
+            SERIAL_HEADER_BYTES = 24
+        };
+    private:
+        std::vector<COUNTER> mCounters;
+        uint64_t mTotal;
+        uint32_t mWidth;
+        uint32_t mDepth;
+    private:
+        static inline COUNTER SaturatingAdd(const COUNTER aA, const COUNTER aB) throw() {
+            const COUNTER sum = static_cast<COUNTER>(aA + aB);
+            return sum < aA ? std::numeric_limits<COUNTER>::max() : sum;
+        }
+
+        inline size_t Index(const uint64_t aHash, const uint32_t aRow) const throw() {
+            const uint32_t row = static_cast<uint32_t>(aHash) + aRow * static_cast<uint32_t>(aHash >> 32);
+            return static_cast<size_t>(aRow) * mWidth + static_cast<size_t>((static_cast<uint64_t>(row) * mWidth) >> 32);
+        }
+
+        void PrefetchHash(const uint64_t aHash) const throw() {
+            for(uint32_t i = 0; i < mDepth; ++i) {
+#if SOLAIRE_COUNT_MIN_SKETCH_SSE2
+                _mm_prefetch(reinterpret_cast<const char*>(mCounters.data() + Index(aHash, i)), _MM_HINT_T0);
+#elif defined(__GNUC__)
+                __builtin_prefetch(mCounters.data() + Index(aHash, i));
+#endif
+            }
+        }
+
+        static void Write32(uint8_t* const aData, const uint32_t aValue) throw() {
+            for(uint32_t i = 0; i < 4; ++i) aData[i] = static_cast<uint8_t>(aValue >> (i * 8));
+        }
+
+        static uint64_t ReadLittleEndian(const uint8_t* const aData, const uint32_t aBytes) throw() {
+            uint64_t value = 0;
+            for(uint32_t i = 0; i < aBytes; ++i) value |= static_cast<uint64_t>(aData[i]) << (i * 8);
+            return value;
+        }
+
+        /*!
+            \brief Check a serialised header against this sketch's dimensions.
+        */
+        bool CheckSerialised(const uint8_t* const aData, const size_t aBytes, uint32_t& aWidth, uint32_t& aDepth) const throw() {
+            if(aBytes < SERIAL_HEADER_BYTES) return false;
+            if(ReadLittleEndian(aData, 4) != SERIAL_MAGIC) return false;
+            if(ReadLittleEndian(aData + 12, 4) != sizeof(COUNTER)) return false;
+            aWidth = static_cast<uint32_t>(ReadLittleEndian(aData + 4, 4));
+            aDepth = static_cast<uint32_t>(ReadLittleEndian(aData + 8, 4));
+            if(aWidth == 0 || aDepth == 0 || aDepth > MAX_DEPTH) return false;
+            return aBytes == SERIAL_HEADER_BYTES + static_cast<size_t>(aWidth) * aDepth * sizeof(COUNTER);
+        }
+    public:
+        /*!
+            \brief Create a sketch with the smallest dimensions that give the requested error bound.
+            \param aEpsilon The over-estimate as a fraction of the total count.
+            \param aDelta The probability that an estimate exceeds the bound.
+        */
+        static CountMinSketch ForError(const double aEpsilon, const double aDelta) {
+            const double width = std::ceil(std::exp(1.0) / aEpsilon);
+            const double depth = std::ceil(std::log(1.0 / aDelta));
+            return CountMinSketch(
+                width > 4294967295.0 ? UINT32_MAX : static_cast<uint32_t>(width),
+                depth < 1.0 ? 1 : depth > MAX_DEPTH ? MAX_DEPTH : static_cast<uint32_t>(depth)
+            );
+        }
+
+        /*!
+            \param aWidth The number of counters in each row, at least 1.
+            \param aDepth The number of rows, 1 to MAX_DEPTH.
+        */
+        CountMinSketch(const uint32_t aWidth, const uint32_t aDepth) :
+            mTotal(0),
+            mWidth(aWidth < 1 ? 1 : aWidth),
+            mDepth(aDepth < 1 ? 1 : aDepth > MAX_DEPTH ? MAX_DEPTH : aDepth)
+        {
+            mCounters.assign(static_cast<size_t>(mWidth) * mDepth, 0);
+        }
+
+        uint32_t Width() const throw() {
+            return mWidth;
+        }
+
+        uint32_t Depth() const throw() {
+            return mDepth;
+        }
+
+        /*!
+            \brief The sum of every count that has been added.
+        */
+        uint64_t TotalCount() const throw() {
+            return mTotal;
+        }
+
+        void Clear() throw() {
+            std::fill(mCounters.begin(), mCounters.end(), static_cast<COUNTER>(0));
+            mTotal = 0;
+        }
+
+        // Hashes
+
+        void UpdateHash(const uint64_t aHash, const COUNTER aCount = 1) throw() {
+            for(uint32_t i = 0; i < mDepth; ++i) {
+                COUNTER& counter = mCounters[Index(aHash, i)];
+                counter = SaturatingAdd(counter, aCount);
+            }
+            mTotal += aCount;
+        }
+
+        void UpdateHashConservative(const uint64_t aHash, const COUNTER aCount = 1) throw() {
+            size_t indices[MAX_DEPTH];
+            COUNTER minimum = std::numeric_limits<COUNTER>::max();
+            for(uint32_t i = 0; i < mDepth; ++i) {
+                indices[i] = Index(aHash, i);
+                if(mCounters[indices[i]] < minimum) minimum = mCounters[indices[i]];
+            }
+
+            const COUNTER estimate = SaturatingAdd(minimum, aCount);
+            for(uint32_t i = 0; i < mDepth; ++i) {
+                COUNTER& counter = mCounters[indices[i]];
+                if(counter < estimate) counter = estimate;
+            }
+            mTotal += aCount;
+        }
+
+        COUNTER QueryHash(const uint64_t aHash) const throw() {
+            COUNTER minimum = std::numeric_limits<COUNTER>::max();
+            for(uint32_t i = 0; i < mDepth; ++i) {
+                const COUNTER counter = mCounters[Index(aHash, i)];
+                if(counter < minimum) minimum = counter;
+            }
+            return minimum;
+        }
+
+        // Keys, see HashKeyBytes and HashKeyLookup
+
+        template<class K>
+        void Update(const K& aKey, const COUNTER aCount = 1) {
+            UpdateHash(static_cast<uint64_t>(HashKeyAs<POLICY, KEY>(aKey)), aCount);
+        }
+
+        template<class K>
+        void UpdateConservative(const K& aKey, const COUNTER aCount = 1) {
+            UpdateHashConservative(static_cast<uint64_t>(HashKeyAs<POLICY, KEY>(aKey)), aCount);
+        }
+
+        template<class K>
+        COUNTER Query(const K& aKey) const {
+            return QueryHash(static_cast<uint64_t>(HashKeyAs<POLICY, KEY>(aKey)));
+        }
+
+        /*!
+            \brief Add 1 for each key, the counters of 16 keys are prefetched before any are updated.
+            \param aConservative Use conservative updates.
+        */
+        template<class K>
+        void UpdateBatch(const K* const aKeys, const size_t aCount, const bool aConservative = false) {
+            uint64_t hashes[BATCH_SIZE];
+            for(size_t begin = 0; begin < aCount; begin += BATCH_SIZE) {
+                const size_t count = std::min<size_t>(aCount - begin, BATCH_SIZE);
+                for(size_t i = 0; i < count; ++i) {
+                    hashes[i] = static_cast<uint64_t>(HashKeyAs<POLICY, KEY>(aKeys[begin + i]));
+                    PrefetchHash(hashes[i]);
+                }
+                if(aConservative) {
+                    for(size_t i = 0; i < count; ++i) UpdateHashConservative(hashes[i]);
+                }else {
+                    for(size_t i = 0; i < count; ++i) UpdateHash(hashes[i]);
+                }
+            }
+        }
+
+        /*!
+            \brief Estimate the counts of many keys, the counters of 16 keys are prefetched before any are read.
+        */
+        template<class K>
+        void QueryBatch(const K* const aKeys, const size_t aCount, COUNTER* const aResults) const {
+            uint64_t hashes[BATCH_SIZE];
+            for(size_t begin = 0; begin < aCount; begin += BATCH_SIZE) {
+                const size_t count = std::min<size_t>(aCount - begin, BATCH_SIZE);
+                for(size_t i = 0; i < count; ++i) {
+                    hashes[i] = static_cast<uint64_t>(HashKeyAs<POLICY, KEY>(aKeys[begin + i]));
+                    PrefetchHash(hashes[i]);
+                }
+                for(size_t i = 0; i < count; ++i) aResults[begin + i] = QueryHash(hashes[i]);
+            }
+        }
+
+        // Merging and serialisation
+
+        /*!
+            \brief Add the counts of another sketch to this one.
+            \return False if the sketches have different dimensions, in which case this sketch is unchanged.
+        */
+        bool Merge(const CountMinSketch& aOther) throw() {
+            if(aOther.mWidth != mWidth || aOther.mDepth != mDepth) return false;
+            for(size_t i = 0; i < mCounters.size(); ++i) mCounters[i] = SaturatingAdd(mCounters[i], aOther.mCounters[i]);
+            mTotal += aOther.mTotal;
+            return true;
+        }
+
+        /*!
+            \brief The size of the serialised form, a 24 byte header followed by the little endian counters.
+        */
+        size_t SerialisedBytes() const throw() {
+            return SERIAL_HEADER_BYTES + mCounters.size() * sizeof(COUNTER);
+        }
+
+        /*!
+            \brief Write the sketch in a portable form.
+            \param aBuffer At least SerialisedBytes() bytes.
+        */
+        void Serialise(void* const aBuffer) const throw() {
+            uint8_t* data = static_cast<uint8_t*>(aBuffer);
+            Write32(data, SERIAL_MAGIC);
+            Write32(data + 4, mWidth);
+            Write32(data + 8, mDepth);
+            Write32(data + 12, sizeof(COUNTER));
+            Write32(data + 16, static_cast<uint32_t>(mTotal));
+            Write32(data + 20, static_cast<uint32_t>(mTotal >> 32));
+            data += SERIAL_HEADER_BYTES;
+
+            for(const COUNTER counter : mCounters) {
+                for(uint32_t i = 0; i < sizeof(COUNTER); ++i) *(data++) = static_cast<uint8_t>(static_cast<uint64_t>(counter) >> (i * 8));
+            }
+        }
+
+        /*!
+            \brief Replace this sketch with a serialised one.
+            \return False if the data is not a sketch with the same counter type, in which case this sketch is unchanged.
+        */
+        bool Deserialise(const void* const aBuffer, const size_t aBytes) {
+            const uint8_t* const data = static_cast<const uint8_t*>(aBuffer);
+            uint32_t width, depth;
+            if(! CheckSerialised(data, aBytes, width, depth)) return false;
+
+            CountMinSketch tmp(width, depth);
+            tmp.MergeSerialised(aBuffer, aBytes);
+            *this = std::move(tmp);
+            return true;
+        }
+
+        /*!
+            \brief Add the counts of a serialised sketch without deserialising it first.
+            \return False if the data is not a sketch of the same dimensions and counter type, in which case this sketch is unchanged.
+        */
+        bool MergeSerialised(const void* const aBuffer, const size_t aBytes) throw() {
+            const uint8_t* data = static_cast<const uint8_t*>(aBuffer);
+            uint32_t width, depth;
+            if(! CheckSerialised(data, aBytes, width, depth) || width != mWidth || depth != mDepth) return false;
+
+            mTotal += ReadLittleEndian(data + 16, 8);
+            data += SERIAL_HEADER_BYTES;
+            for(COUNTER& counter : mCounters) {
+                counter = SaturatingAdd(counter, static_cast<COUNTER>(ReadLittleEndian(data, sizeof(COUNTER))));
+                data += sizeof(COUNTER);
+            }
+            return true;
+        }
+    };
+}
+
+#endif
@@ -28,22 +28,149 @@ Last modified	: Adam Smith
 \version 1.0
 \date
 Created			: 1st October 2015
-Last Modified	: 1st October 2015
+Last Modified	: 16th October 2026
 */
 
+#include <utility>
 #include "HashFunction.hpp"
 #include "..\Reflect.hpp"
+#include "..\CpuDispatch.hpp"
+
+// The folding code is always built on x86-64 and is only used if getCpuFeatures reports PCLMULQDQ and SSSE3
+#if SOLAIRE_RUNTIME_DISPATCH
+    #define SOLAIRE_CRC_CLMUL 1
+    #include <immintrin.h>
+#else
+    #define SOLAIRE_CRC_CLMUL 0
+#endif
 
 namespace Solaire {
 
-    template<class T, const T POLYNOMIAL, const T INITIAL_REMAINDER, const T FINAL_XOR_VALUE, const bool REFLECT_DATA, const bool REFLECT_REMAINDER>
+    namespace CrcImplementation {
+        template<class CRC, class SEQUENCE>
+        struct SliceTable;
+
+        /*!
+            \brief The lookup tables used to process several bytes of data per iteration.
+            \details Entry [s * 256 + i] is the remainder after processing byte i followed by s zero bytes.
+        */
+        template<class CRC, size_t... INDICES>
+        struct SliceTable<CRC, std::index_sequence<INDICES...>> {
+            static constexpr typename CRC::HashType VALUES[sizeof...(INDICES)] = {
+                CRC::CalculateSliceEntry(INDICES / 256, INDICES % 256)...
+            };
+        };
+
+        template<class CRC, size_t... INDICES>
+        constexpr typename CRC::HashType SliceTable<CRC, std::index_sequence<INDICES...>>::VALUES[sizeof...(INDICES)];
+
+        static inline uint32_t ReadLittleEndian32(const uint8_t* const aData) throw() {
+            return
+                static_cast<uint32_t>(aData[0]) |
+                (static_cast<uint32_t>(aData[1]) << 8) |
+                (static_cast<uint32_t>(aData[2]) << 16) |
+                (static_cast<uint32_t>(aData[3]) << 24);
+        }
+
+        static inline uint32_t ReadBigEndian32(const uint8_t* const aData) throw() {
+            return
+                (static_cast<uint32_t>(aData[0]) << 24) |
+                (static_cast<uint32_t>(aData[1]) << 16) |
+                (static_cast<uint32_t>(aData[2]) << 8) |
+                static_cast<uint32_t>(aData[3]);
+        }
+
+        enum : size_t{
+            PARALLEL_MIN_BYTES = 1024 * 1024,   //!< The smallest block of data that will be given to a thread.
+            PARALLEL_MAX_BLOCKS = 64            //!< The largest number of blocks that data is split into.
+        };
+
+        /*!
+            \brief Call aTask(aContext, i) for every i below aCount, using a pool of threads that is kept between calls.
+            \details
+            The calling thread takes tasks as well, and returns once every task has finished. Up to aThreads - 1 pool
+            threads are used. If a thread cannot be created, or the pool is already in use by another call, the
+            remaining tasks are run on the calling thread.
+        */
+        void ParallelFor(const size_t aCount, const uint32_t aThreads, void(*aTask)(void*, size_t), void* const aContext) throw();
+
+        template<class T>
+        struct ParallelHash {
+            const uint8_t* Data;
+            size_t Bytes;
+            size_t BlockBytes;
+            size_t Blocks;
+            T(*Hash)(const void*, size_t);
+            T Results[PARALLEL_MAX_BLOCKS];
+
+            inline size_t BytesOf(const size_t aBlock) const throw() {
+                return aBlock + 1 == Blocks ? Bytes - BlockBytes * aBlock : BlockBytes;
+            }
+
+            static void HashBlock(void* const aContext, const size_t aBlock) throw() {
+                ParallelHash& context = *static_cast<ParallelHash*>(aContext);
+                context.Results[aBlock] = context.Hash(context.Data + context.BlockBytes * aBlock, context.BytesOf(aBlock));
+            }
+        };
+
+        /*!
+            \brief Hash blocks of data on separate threads and combine the results.
+            \param aValue The address of the data.
+            \param aBytes The number of bytes to hash.
+            \param aThreads The maximum number of threads to use, including the calling thread.
+            \param aHash Calculates the CRC of a single block.
+            \param aCombine Calculates the CRC of two concatenated blocks.
+            \return The CRC of the data.
+        */
+        template<class T>
+        static T HashParallel(const void* const aValue, const size_t aBytes, const uint32_t aThreads, T(*aHash)(const void*, size_t), T(*aCombine)(T, T, uint64_t)) throw() {
+            size_t blocks = aBytes / PARALLEL_MIN_BYTES;
+            if(blocks > aThreads) blocks = aThreads;
+            if(blocks > PARALLEL_MAX_BLOCKS) blocks = PARALLEL_MAX_BLOCKS;
+            if(blocks <= 1) return aHash(aValue, aBytes);
+
+            ParallelHash<T> context;
+            context.Data = static_cast<const uint8_t*>(aValue);
+            context.Bytes = aBytes;
+            context.BlockBytes = aBytes / blocks;
+            context.Blocks = blocks;
+            context.Hash = aHash;
+            ParallelFor(blocks, static_cast<uint32_t>(blocks), &ParallelHash<T>::HashBlock, &context);
+
+            T crc = context.Results[0];
+            for(size_t i = 1; i < blocks; ++i) crc = aCombine(crc, context.Results[i], context.BytesOf(i));
+            return crc;
+        }
+    }
+
+    /*!
+        \brief A table driven cyclic redundancy check.
+        \details
+        Inputs shorter than SLICE_THRESHOLD bytes are processed one byte at a time with a single 256 entry table,
+        longer inputs are processed SLICES bytes at a time using SLICES tables (slicing-by-8 or slicing-by-16).
+        SLICES can be 1 to disable slicing, it is ignored for CRCs wider than 32 bits.
+        When the processor supports PCLMULQDQ inputs of at least CLMUL_THRESHOLD bytes are folded 64 bytes at a time with
+        carry-less multiplication, the folding constants are derived from POLYNOMIAL at compile time.
+        When REFLECT_DATA is set the remainder is kept in reflected form so that no per-byte reflection is needed.
+    */
+    template<class T, const T POLYNOMIAL, const T INITIAL_REMAINDER, const T FINAL_XOR_VALUE, const bool REFLECT_DATA, const bool REFLECT_REMAINDER, const uint32_t SLICES = 8>
     class Crc : public HashFunction<T> {
     private:
+        static_assert(SLICES == 1 || SLICES == 8 || SLICES == 16, "Solaire::Crc : SLICES must be 1, 8 or 16");
+
+        template<class CRC, class SEQUENCE>
+        friend struct CrcImplementation::SliceTable;
+
         enum : T{
             WIDTH = 8 * sizeof(T),
             TOPBIT  = static_cast<T>(1 << (WIDTH - 1))
         };
-
+    public:
+        enum : size_t{
+            SLICE_THRESHOLD = 64,   //!< The minimum number of bytes that will be processed with the slicing tables.
+            CLMUL_THRESHOLD = 256   //!< The minimum number of bytes that will be processed with carry-less multiplication.
+        };
+    private:
         static constexpr T CalculateCrcBit(const T aRemainder, const uint8_t aBit){
             return aRemainder & TOPBIT ?
                 (aRemainder << 1) ^ POLYNOMIAL :
@@ -71,76 +198,439 @@ namespace Solaire {
             0);
         }
 
+        static constexpr T CalculateTableEntry(const uint8_t aIndex){
+            return REFLECT_DATA ?
+                reflect<T>(CalculateCrc(reflect8(aIndex))) :
+                CalculateCrc(aIndex);
+        }
+
+        static constexpr T CalculateZeroByte(const T aRemainder){
+            return REFLECT_DATA ?
+                static_cast<T>((aRemainder >> 8) ^ CalculateTableEntry(aRemainder & 0xFF)) :
+                static_cast<T>((aRemainder << 8) ^ CalculateTableEntry(aRemainder >> (WIDTH - 8)));
+        }
+
+        static constexpr T CalculateSliceEntry(const size_t aSlice, const size_t aIndex){
+            return aSlice == 0 ?
+                CalculateTableEntry(static_cast<uint8_t>(aIndex)) :
+                CalculateZeroByte(CalculateSliceEntry(aSlice - 1, aIndex));
+        }
+
         static constexpr T CRC_TABLE[256] ={
-            CalculateCrc(0),	CalculateCrc(1),	CalculateCrc(2),	CalculateCrc(3),	CalculateCrc(4),	CalculateCrc(5),
-            CalculateCrc(6),	CalculateCrc(7),	CalculateCrc(8),	CalculateCrc(9),	CalculateCrc(10),	CalculateCrc(11),
-            CalculateCrc(12),	CalculateCrc(13),	CalculateCrc(14),	CalculateCrc(15),	CalculateCrc(16),	CalculateCrc(17),
-            CalculateCrc(18),	CalculateCrc(19),	CalculateCrc(20),	CalculateCrc(21),	CalculateCrc(22),	CalculateCrc(23),
-            CalculateCrc(24),	CalculateCrc(25),	CalculateCrc(26),	CalculateCrc(27),	CalculateCrc(28),	CalculateCrc(29),
-            CalculateCrc(30),	CalculateCrc(31),	CalculateCrc(32),	CalculateCrc(33),	CalculateCrc(34),	CalculateCrc(35),
-            CalculateCrc(36),	CalculateCrc(37),	CalculateCrc(38),	CalculateCrc(39),	CalculateCrc(40),	CalculateCrc(41),
-            CalculateCrc(42),	CalculateCrc(43),	CalculateCrc(44),	CalculateCrc(45),	CalculateCrc(46),	CalculateCrc(47),
-            CalculateCrc(48),	CalculateCrc(49),	CalculateCrc(50),	CalculateCrc(51),	CalculateCrc(52),	CalculateCrc(53),
-            CalculateCrc(54),	CalculateCrc(55),	CalculateCrc(56),	CalculateCrc(57),	CalculateCrc(58),	CalculateCrc(59),
-            CalculateCrc(60),	CalculateCrc(61),	CalculateCrc(62),	CalculateCrc(63),	CalculateCrc(64),	CalculateCrc(65),
-            CalculateCrc(66),	CalculateCrc(67),	CalculateCrc(68),	CalculateCrc(69),	CalculateCrc(70),	CalculateCrc(71),
-            CalculateCrc(72),	CalculateCrc(73),	CalculateCrc(74),	CalculateCrc(75),	CalculateCrc(76),	CalculateCrc(77),
-            CalculateCrc(78),	CalculateCrc(79),	CalculateCrc(80),	CalculateCrc(81),	CalculateCrc(82),	CalculateCrc(83),
-            CalculateCrc(84),	CalculateCrc(85),	CalculateCrc(86),	CalculateCrc(87),	CalculateCrc(88),	CalculateCrc(89),
-            CalculateCrc(90),	CalculateCrc(91),	CalculateCrc(92),	CalculateCrc(93),	CalculateCrc(94),	CalculateCrc(95),
-            CalculateCrc(96),	CalculateCrc(97),	CalculateCrc(98),	CalculateCrc(99),	CalculateCrc(100),	CalculateCrc(101),
-            CalculateCrc(102),	CalculateCrc(103),	CalculateCrc(104),	CalculateCrc(105),	CalculateCrc(106),	CalculateCrc(107),
-            CalculateCrc(108),	CalculateCrc(109),	CalculateCrc(110),	CalculateCrc(111),	CalculateCrc(112),	CalculateCrc(113),
-            CalculateCrc(114),	CalculateCrc(115),	CalculateCrc(116),	CalculateCrc(117),	CalculateCrc(118),	CalculateCrc(119),
-            CalculateCrc(120),	CalculateCrc(121),	CalculateCrc(122),	CalculateCrc(123),	CalculateCrc(124),	CalculateCrc(125),
-            CalculateCrc(126),	CalculateCrc(127),	CalculateCrc(128),	CalculateCrc(129),	CalculateCrc(130),	CalculateCrc(131),
-            CalculateCrc(132),	CalculateCrc(133),	CalculateCrc(134),	CalculateCrc(135),	CalculateCrc(136),	CalculateCrc(137),
-            CalculateCrc(138),	CalculateCrc(139),	CalculateCrc(140),	CalculateCrc(141),	CalculateCrc(142),	CalculateCrc(143),
-            CalculateCrc(144),	CalculateCrc(145),	CalculateCrc(146),	CalculateCrc(147),	CalculateCrc(148),	CalculateCrc(149),
-            CalculateCrc(150),	CalculateCrc(151),	CalculateCrc(152),	CalculateCrc(153),	CalculateCrc(154),	CalculateCrc(155),
-            CalculateCrc(156),	CalculateCrc(157),	CalculateCrc(158),	CalculateCrc(159),	CalculateCrc(160),	CalculateCrc(161),
-            CalculateCrc(162),	CalculateCrc(163),	CalculateCrc(164),	CalculateCrc(165),	CalculateCrc(166),	CalculateCrc(167),
-            CalculateCrc(168),	CalculateCrc(169),	CalculateCrc(170),	CalculateCrc(171),	CalculateCrc(172),	CalculateCrc(173),
-            CalculateCrc(174),	CalculateCrc(175),	CalculateCrc(176),	CalculateCrc(177),	CalculateCrc(178),	CalculateCrc(179),
-            CalculateCrc(180),	CalculateCrc(181),	CalculateCrc(182),	CalculateCrc(183),	CalculateCrc(184),	CalculateCrc(185),
-            CalculateCrc(186),	CalculateCrc(187),	CalculateCrc(188),	CalculateCrc(189),	CalculateCrc(190),	CalculateCrc(191),
-            CalculateCrc(192),	CalculateCrc(193),	CalculateCrc(194),	CalculateCrc(195),	CalculateCrc(196),	CalculateCrc(197),
-            CalculateCrc(198),	CalculateCrc(199),	CalculateCrc(200),	CalculateCrc(201),	CalculateCrc(202),	CalculateCrc(203),
-            CalculateCrc(204),	CalculateCrc(205),	CalculateCrc(206),	CalculateCrc(207),	CalculateCrc(208),	CalculateCrc(209),
-            CalculateCrc(210),	CalculateCrc(211),	CalculateCrc(212),	CalculateCrc(213),	CalculateCrc(214),	CalculateCrc(215),
-            CalculateCrc(216),	CalculateCrc(217),	CalculateCrc(218),	CalculateCrc(219),	CalculateCrc(220),	CalculateCrc(221),
-            CalculateCrc(222),	CalculateCrc(223),	CalculateCrc(224),	CalculateCrc(225),	CalculateCrc(226),	CalculateCrc(227),
-            CalculateCrc(228),	CalculateCrc(229),	CalculateCrc(230),	CalculateCrc(231),	CalculateCrc(232),	CalculateCrc(233),
-            CalculateCrc(234),	CalculateCrc(235),	CalculateCrc(236),	CalculateCrc(237),	CalculateCrc(238),	CalculateCrc(239),
-            CalculateCrc(240),	CalculateCrc(241),	CalculateCrc(242),	CalculateCrc(243),	CalculateCrc(244),	CalculateCrc(245),
-            CalculateCrc(246),	CalculateCrc(247),	CalculateCrc(248),	CalculateCrc(249),	CalculateCrc(250),	CalculateCrc(251),
-            CalculateCrc(252),	CalculateCrc(253),	CalculateCrc(254),	CalculateCrc(255)
+            CalculateTableEntry(0),	CalculateTableEntry(1),	CalculateTableEntry(2),	CalculateTableEntry(3),	CalculateTableEntry(4),	CalculateTableEntry(5),
+            CalculateTableEntry(6),	CalculateTableEntry(7),	CalculateTableEntry(8),	CalculateTableEntry(9),	CalculateTableEntry(10),	CalculateTableEntry(11),
+            CalculateTableEntry(12),	CalculateTableEntry(13),	CalculateTableEntry(14),	CalculateTableEntry(15),	CalculateTableEntry(16),	CalculateTableEntry(17),
+            CalculateTableEntry(18),	CalculateTableEntry(19),	CalculateTableEntry(20),	CalculateTableEntry(21),	CalculateTableEntry(22),	CalculateTableEntry(23),
+            CalculateTableEntry(24),	CalculateTableEntry(25),	CalculateTableEntry(26),	CalculateTableEntry(27),	CalculateTableEntry(28),	CalculateTableEntry(29),
+            CalculateTableEntry(30),	CalculateTableEntry(31),	CalculateTableEntry(32),	CalculateTableEntry(33),	CalculateTableEntry(34),	CalculateTableEntry(35),
+            CalculateTableEntry(36),	CalculateTableEntry(37),	CalculateTableEntry(38),	CalculateTableEntry(39),	CalculateTableEntry(40),	CalculateTableEntry(41),
+            CalculateTableEntry(42),	CalculateTableEntry(43),	CalculateTableEntry(44),	CalculateTableEntry(45),	CalculateTableEntry(46),	CalculateTableEntry(47),
+            CalculateTableEntry(48),	CalculateTableEntry(49),	CalculateTableEntry(50),	CalculateTableEntry(51),	CalculateTableEntry(52),	CalculateTableEntry(53),
+            CalculateTableEntry(54),	CalculateTableEntry(55),	CalculateTableEntry(56),	CalculateTableEntry(57),	CalculateTableEntry(58),	CalculateTableEntry(59),
+            CalculateTableEntry(60),	CalculateTableEntry(61),	CalculateTableEntry(62),	CalculateTableEntry(63),	CalculateTableEntry(64),	CalculateTableEntry(65),
+            CalculateTableEntry(66),	CalculateTableEntry(67),	CalculateTableEntry(68),	CalculateTableEntry(69),	CalculateTableEntry(70),	CalculateTableEntry(71),
+            CalculateTableEntry(72),	CalculateTableEntry(73),	CalculateTableEntry(74),	CalculateTableEntry(75),	CalculateTableEntry(76),	CalculateTableEntry(77),
+            CalculateTableEntry(78),	CalculateTableEntry(79),	CalculateTableEntry(80),	CalculateTableEntry(81),	CalculateTableEntry(82),	CalculateTableEntry(83),
+            CalculateTableEntry(84),	CalculateTableEntry(85),	CalculateTableEntry(86),	CalculateTableEntry(87),	CalculateTableEntry(88),	CalculateTableEntry(89),
+            CalculateTableEntry(90),	CalculateTableEntry(91),	CalculateTableEntry(92),	CalculateTableEntry(93),	CalculateTableEntry(94),	CalculateTableEntry(95),
+            CalculateTableEntry(96),	CalculateTableEntry(97),	CalculateTableEntry(98),	CalculateTableEntry(99),	CalculateTableEntry(100),	CalculateTableEntry(101),
+            CalculateTableEntry(102),	CalculateTableEntry(103),	CalculateTableEntry(104),	CalculateTableEntry(105),	CalculateTableEntry(106),	CalculateTableEntry(107),
+            CalculateTableEntry(108),	CalculateTableEntry(109),	CalculateTableEntry(110),	CalculateTableEntry(111),	CalculateTableEntry(112),	CalculateTableEntry(113),
+            CalculateTableEntry(114),	CalculateTableEntry(115),	CalculateTableEntry(116),	CalculateTableEntry(117),	CalculateTableEntry(118),	CalculateTableEntry(119),
+            CalculateTableEntry(120),	CalculateTableEntry(121),	CalculateTableEntry(122),	CalculateTableEntry(123),	CalculateTableEntry(124),	CalculateTableEntry(125),
+            CalculateTableEntry(126),	CalculateTableEntry(127),	CalculateTableEntry(128),	CalculateTableEntry(129),	CalculateTableEntry(130),	CalculateTableEntry(131),
+            CalculateTableEntry(132),	CalculateTableEntry(133),	CalculateTableEntry(134),	CalculateTableEntry(135),	CalculateTableEntry(136),	CalculateTableEntry(137),
+            CalculateTableEntry(138),	CalculateTableEntry(139),	CalculateTableEntry(140),	CalculateTableEntry(141),	CalculateTableEntry(142),	CalculateTableEntry(143),
+            CalculateTableEntry(144),	CalculateTableEntry(145),	CalculateTableEntry(146),	CalculateTableEntry(147),	CalculateTableEntry(148),	CalculateTableEntry(149),
+            CalculateTableEntry(150),	CalculateTableEntry(151),	CalculateTableEntry(152),	CalculateTableEntry(153),	CalculateTableEntry(154),	CalculateTableEntry(155),
+            CalculateTableEntry(156),	CalculateTableEntry(157),	CalculateTableEntry(158),	CalculateTableEntry(159),	CalculateTableEntry(160),	CalculateTableEntry(161),
+            CalculateTableEntry(162),	CalculateTableEntry(163),	CalculateTableEntry(164),	CalculateTableEntry(165),	CalculateTableEntry(166),	CalculateTableEntry(167),
+            CalculateTableEntry(168),	CalculateTableEntry(169),	CalculateTableEntry(170),	CalculateTableEntry(171),	CalculateTableEntry(172),	CalculateTableEntry(173),
+            CalculateTableEntry(174),	CalculateTableEntry(175),	CalculateTableEntry(176),	CalculateTableEntry(177),	CalculateTableEntry(178),	CalculateTableEntry(179),
+            CalculateTableEntry(180),	CalculateTableEntry(181),	CalculateTableEntry(182),	CalculateTableEntry(183),	CalculateTableEntry(184),	CalculateTableEntry(185),
+            CalculateTableEntry(186),	CalculateTableEntry(187),	CalculateTableEntry(188),	CalculateTableEntry(189),	CalculateTableEntry(190),	CalculateTableEntry(191),
+            CalculateTableEntry(192),	CalculateTableEntry(193),	CalculateTableEntry(194),	CalculateTableEntry(195),	CalculateTableEntry(196),	CalculateTableEntry(197),
+            CalculateTableEntry(198),	CalculateTableEntry(199),	CalculateTableEntry(200),	CalculateTableEntry(201),	CalculateTableEntry(202),	CalculateTableEntry(203),
+            CalculateTableEntry(204),	CalculateTableEntry(205),	CalculateTableEntry(206),	CalculateTableEntry(207),	CalculateTableEntry(208),	CalculateTableEntry(209),
+            CalculateTableEntry(210),	CalculateTableEntry(211),	CalculateTableEntry(212),	CalculateTableEntry(213),	CalculateTableEntry(214),	CalculateTableEntry(215),
+            CalculateTableEntry(216),	CalculateTableEntry(217),	CalculateTableEntry(218),	CalculateTableEntry(219),	CalculateTableEntry(220),	CalculateTableEntry(221),
+            CalculateTableEntry(222),	CalculateTableEntry(223),	CalculateTableEntry(224),	CalculateTableEntry(225),	CalculateTableEntry(226),	CalculateTableEntry(227),
+            CalculateTableEntry(228),	CalculateTableEntry(229),	CalculateTableEntry(230),	CalculateTableEntry(231),	CalculateTableEntry(232),	CalculateTableEntry(233),
+            CalculateTableEntry(234),	CalculateTableEntry(235),	CalculateTableEntry(236),	CalculateTableEntry(237),	CalculateTableEntry(238),	CalculateTableEntry(239),
+            CalculateTableEntry(240),	CalculateTableEntry(241),	CalculateTableEntry(242),	CalculateTableEntry(243),	CalculateTableEntry(244),	CalculateTableEntry(245),
+            CalculateTableEntry(246),	CalculateTableEntry(247),	CalculateTableEntry(248),	CalculateTableEntry(249),	CalculateTableEntry(250),	CalculateTableEntry(251),
+            CalculateTableEntry(252),	CalculateTableEntry(253),	CalculateTableEntry(254),	CalculateTableEntry(255)
         };
+
+        static T UpdateBytes(T aRemainder, const uint8_t* aData, const uint8_t* const aEnd) throw() {
+            while(aData != aEnd){
+                const uint8_t data = *(aData++);
+                if(REFLECT_DATA) {
+                    aRemainder = CRC_TABLE[(aRemainder ^ data) & 0xFF] ^ (aRemainder >> 8);
+                }else {
+                    aRemainder = CRC_TABLE[(aRemainder >> (WIDTH - 8)) ^ data] ^ (aRemainder << 8);
+                }
+            }
+            return aRemainder;
+        }
+
+        static constexpr T UpdateChars(T aRemainder, const char* const aString, const size_t aBytes){
+            for(size_t i = 0; i < aBytes; ++i) {
+                aRemainder = REFLECT_DATA ?
+                    static_cast<T>(CRC_TABLE[(aRemainder ^ static_cast<uint8_t>(aString[i])) & 0xFF] ^ (aRemainder >> 8)) :
+                    static_cast<T>(CRC_TABLE[((aRemainder >> (WIDTH - 8)) ^ static_cast<uint8_t>(aString[i])) & 0xFF] ^ (aRemainder << 8));
+            }
+            return aRemainder;
+        }
+
+        static T UpdateSlices(T aRemainder, const uint8_t* aData, const size_t aBytes) throw() {
+            typedef CrcImplementation::SliceTable<Crc, std::make_index_sequence<256 * SLICES>> Tables;
+            const uint8_t* const end = aData + (aBytes - aBytes % SLICES);
+
+            while(aData != end) {
+                T remainder = 0;
+                for(uint32_t i = 0; i < SLICES; i += 4) {
+                    // Byte n of the block is looked up in slice (SLICES - 1 - n)
+                    const T* const table = Tables::VALUES + (SLICES - 4 - i) * 256;
+                    if(REFLECT_DATA) {
+                        uint32_t word = CrcImplementation::ReadLittleEndian32(aData + i);
+                        if(i == 0) word ^= aRemainder;
+                        remainder ^=
+                            table[768 + (word & 0xFF)] ^
+                            table[512 + ((word >> 8) & 0xFF)] ^
+                            table[256 + ((word >> 16) & 0xFF)] ^
+                            table[word >> 24];
+                    }else {
+                        uint32_t word = CrcImplementation::ReadBigEndian32(aData + i);
+                        if(i == 0) word ^= static_cast<uint32_t>(aRemainder) << (32 - WIDTH);
+                        remainder ^=
+                            table[768 + (word >> 24)] ^
+                            table[512 + ((word >> 16) & 0xFF)] ^
+                            table[256 + ((word >> 8) & 0xFF)] ^
+                            table[word & 0xFF];
+                    }
+                }
+                aRemainder = remainder;
+                aData += SLICES;
+            }
+
+            return UpdateBytes(aRemainder, aData, aData + aBytes % SLICES);
+        }
+
+        static constexpr T MultiplyBits(const T aA, const T aB, const int32_t aBit, const T aProduct){
+            return aBit < 0 ? aProduct :
+                MultiplyBits(aA, aB, aBit - 1, CalculateCrcBit(aProduct, 0) ^ (((aA >> aBit) & 1) ? aB : 0));
+        }
+
+        /*!
+            \brief Multiply two polynomials modulo POLYNOMIAL.
+        */
+        static constexpr T Multiply(const T aA, const T aB){
+            return MultiplyBits(aA, aB, WIDTH - 1, 0);
+        }
+
+        static constexpr T Square(const T aA){
+            return Multiply(aA, aA);
+        }
+
+        /*!
+            \brief Calculate x^aPower modulo POLYNOMIAL.
+        */
+        static constexpr T XPower(const uint64_t aPower){
+            return
+                aPower == 0 ? 1 :
+                aPower & 1 ? CalculateCrcBit(XPower(aPower - 1), 0) :
+                Square(XPower(aPower / 2));
+        }
+
+        /*!
+            \brief Convert a CRC value back into an unreflected remainder.
+        */
+        static constexpr T RemainderOf(const T aCrc){
+            return REFLECT_REMAINDER ? reflect<T>(aCrc ^ FINAL_XOR_VALUE) : aCrc ^ FINAL_XOR_VALUE;
+        }
+
+#if SOLAIRE_CRC_CLMUL
+        /*!
+            \brief Calculate the constant that folds a 64 bit half of a block forward by aBits bits.
+            \details
+            Reflected data is held in reversed bit order, the product of two reversed 64 bit values is the reversed product
+            shifted up by one bit, which is compensated for by using one less power of x.
+        */
+        static constexpr uint64_t FoldConstant(const uint32_t aBits){
+            return REFLECT_DATA ?
+                reflect64(XPower(aBits - 1)) :
+                static_cast<uint64_t>(XPower(aBits));
+        }
+
+        // The constants that multiply the low and high halves of a block, by 512 bits between 64 byte blocks and 128 bits between 16 byte blocks
+        static constexpr uint64_t FOLD_512_LOW = REFLECT_DATA ? FoldConstant(512 + 64) : FoldConstant(512);
+        static constexpr uint64_t FOLD_512_HIGH = REFLECT_DATA ? FoldConstant(512) : FoldConstant(512 + 64);
+        static constexpr uint64_t FOLD_128_LOW = REFLECT_DATA ? FoldConstant(128 + 64) : FoldConstant(128);
+        static constexpr uint64_t FOLD_128_HIGH = REFLECT_DATA ? FoldConstant(128) : FoldConstant(128 + 64);
+
+        SOLAIRE_TARGET("pclmul,ssse3")
+        static __m128i LoadBlock(const uint8_t* const aData) throw() {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(aData));
+            return REFLECT_DATA ? block : _mm_shuffle_epi8(block, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+        }
+
+        SOLAIRE_TARGET("pclmul,ssse3")
+        static __m128i FoldBlock(const __m128i aBlock, const __m128i aConstants, const __m128i aNext) throw() {
+            return _mm_xor_si128(
+                _mm_xor_si128(_mm_clmulepi64_si128(aBlock, aConstants, 0x00), _mm_clmulepi64_si128(aBlock, aConstants, 0x11)),
+                aNext
+            );
+        }
+
+        SOLAIRE_TARGET("pclmul,ssse3")
+        static T UpdateFold(const T aRemainder, const uint8_t* aData, size_t aBytes) throw() {
+            // The low half of each block is multiplied by the low constant and the high half by the high constant
+            const __m128i fold512 = _mm_set_epi64x(FOLD_512_HIGH, FOLD_512_LOW);
+            const __m128i fold128 = _mm_set_epi64x(FOLD_128_HIGH, FOLD_128_LOW);
+
+            // The remainder is added to the first bits of the data
+            const __m128i remainder = REFLECT_DATA ?
+                _mm_cvtsi32_si128(static_cast<int>(aRemainder)) :
+                _mm_set_epi32(static_cast<int>(static_cast<uint32_t>(aRemainder) << (32 - WIDTH)), 0, 0, 0);
+
+            __m128i x0 = _mm_xor_si128(LoadBlock(aData), remainder);
+            __m128i x1 = LoadBlock(aData + 16);
+            __m128i x2 = LoadBlock(aData + 32);
+            __m128i x3 = LoadBlock(aData + 48);
+            aData += 64;
+            aBytes -= 64;
+
+            while(aBytes >= 64) {
+                x0 = FoldBlock(x0, fold512, LoadBlock(aData));
+                x1 = FoldBlock(x1, fold512, LoadBlock(aData + 16));
+                x2 = FoldBlock(x2, fold512, LoadBlock(aData + 32));
+                x3 = FoldBlock(x3, fold512, LoadBlock(aData + 48));
+                aData += 64;
+                aBytes -= 64;
+            }
+
+            x0 = FoldBlock(x0, fold128, x1);
+            x0 = FoldBlock(x0, fold128, x2);
+            x0 = FoldBlock(x0, fold128, x3);
+
+            while(aBytes >= 16) {
+                x0 = FoldBlock(x0, fold128, LoadBlock(aData));
+                aData += 16;
+                aBytes -= 16;
+            }
+
+            // The folded block is congruent to all of the data so far, reduce it to a remainder with the table
+            uint8_t block[16];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(block), LoadBlock(reinterpret_cast<const uint8_t*>(&x0)));
+            return UpdateBytes(UpdateBytes(0, block, block + 16), aData, aData + aBytes);
+        }
+#endif
     public:
-        // Inherited from HashFunction
-        T SOLAIRE_EXPORT_CALL Hash(const void* const aValue, const size_t aBytes) const throw() override{
-			const uint8_t* ptr = static_cast<const uint8_t*>(aValue);
-			const uint8_t* const end = ptr + aBytes;
+        /*!
+            \brief The remainder before any data has been processed.
+            \details Reflected CRCs keep their remainder in reflected form.
+            \return The initial remainder.
+        */
+        static constexpr T InitialRemainder(){
+            return REFLECT_DATA ? reflect<T>(INITIAL_REMAINDER) : INITIAL_REMAINDER;
+        }
+
+        /*!
+            \brief Process data into a remainder.
+            \param aRemainder The remainder of the data that has already been processed.
+            \param aValue The address of the data.
+            \param aBytes The number of bytes to process.
+            \return The updated remainder.
+        */
+        static T UpdateRemainder(const T aRemainder, const void* const aValue, const size_t aBytes) throw() {
+            const uint8_t* const data = static_cast<const uint8_t*>(aValue);
+#if SOLAIRE_CRC_CLMUL
+            if(WIDTH <= 32 && aBytes >= CLMUL_THRESHOLD && hasCpuFeatures(CPU_PCLMUL | CPU_SSSE3)) return UpdateFold(aRemainder, data, aBytes);
+#endif
+            return SLICES > 1 && WIDTH <= 32 && aBytes >= SLICE_THRESHOLD ?
+                UpdateSlices(aRemainder, data, aBytes) :
+                UpdateBytes(aRemainder, data, data + aBytes);
+        }
+
+        /*!
+            \brief Convert a remainder into the CRC value.
+            \param aRemainder The remainder.
+            \return The CRC.
+        */
+        static constexpr T FinalRemainder(const T aRemainder){
+            return (REFLECT_DATA == REFLECT_REMAINDER ? aRemainder : reflect<T>(aRemainder)) ^ FINAL_XOR_VALUE;
+        }
+
+        /*!
+            \brief Static form of the CRC that can be inlined, see HashFunctionAdapter.
+        */
+        struct Policy {
+            typedef T HashType;
+
+            static inline T Hash(const void* const aValue, const size_t aBytes) throw() {
+                return FinalRemainder(UpdateRemainder(InitialRemainder(), aValue, aBytes));
+            }
+
+            /*!
+                \brief Calculate the CRC of characters during compilation, gives the same value as Hash.
+            */
+            static constexpr T HashChars(const char* const aString, const size_t aBytes) {
+                return FinalRemainder(UpdateChars(InitialRemainder(), aString, aBytes));
+            }
+
+            /*!
+                \brief Calculate the CRC of a string literal or char array during compilation, see HashCharsLength.
+            */
+            template<const size_t LENGTH>
+            static constexpr T Hash(const char (&aString)[LENGTH]) {
+                return HashChars(aString, HashCharsLength(aString));
+            }
+        };
+
+        /*!
+            \brief Calculate the CRC of two concatenated blocks of data from the CRCs of each block.
+            \param aCrcA The CRC of the first block.
+            \param aCrcB The CRC of the second block.
+            \param aBytesB The length of the second block in bytes.
+            \return The CRC of the first block followed by the second block.
+        */
+        static T Combine(const T aCrcA, const T aCrcB, const uint64_t aBytesB) throw() {
+            // Advance the first remainder past the second block, without the initial remainder that the second block already includes
+            const T remainder =
+                Multiply(XPower(aBytesB * 8), RemainderOf(aCrcA) ^ INITIAL_REMAINDER) ^
+                RemainderOf(aCrcB);
+            return (REFLECT_REMAINDER ? reflect<T>(remainder) : remainder) ^ FINAL_XOR_VALUE;
+        }
+
+        /*!
+            \brief Calculate the CRC of data by splitting it between several threads.
+            \param aValue The address of the data.
+            \param aBytes The number of bytes to hash.
+            \param aThreads The maximum number of threads to use, including the calling thread.
+            \return The CRC of the data.
+        */
+        T Hash(const void* const aValue, const size_t aBytes, const uint32_t aThreads) const throw() {
+            return CrcImplementation::HashParallel<T>(aValue, aBytes, aThreads, &Policy::Hash, &Combine);
+        }
+
+        class State : public HashState<T> {
+        private:
+            T mRemainder;
+        public:
+            State() throw() :
+                mRemainder(InitialRemainder())
+            {}
+
+            SOLAIRE_EXPORT_CALL ~State() throw() {
+
+            }
+
+            // Inherited from HashState
 
-			T remainder = INITIAL_REMAINDER;
+            void SOLAIRE_EXPORT_CALL Initialise() throw() override {
+                mRemainder = InitialRemainder();
+            }
 
-            while(ptr != end){
-                uint8_t data = *(ptr++);
-                if(REFLECT_DATA) data = reflect<uint8_t>(data);
-                data ^= remainder >> (WIDTH - 8);
-                remainder = CRC_TABLE[data] ^ (remainder << 8);
+            void SOLAIRE_EXPORT_CALL Update(const void* const aValue, const size_t aBytes) throw() override {
+                mRemainder = UpdateRemainder(mRemainder, aValue, aBytes);
             }
 
-            return (REFLECT_REMAINDER ? reflect<T>(remainder): remainder) ^ FINAL_XOR_VALUE;
+            T SOLAIRE_EXPORT_CALL Finalise() const throw() override {
+                return FinalRemainder(mRemainder);
+            }
+        };
+    public:
+        // Inherited from HashFunction
+        T SOLAIRE_EXPORT_CALL Hash(const void* const aValue, const size_t aBytes) const throw() override{
+            return Policy::Hash(aValue, aBytes);
         }
     };
 
-    template<class T, const T POLYNOMIAL, const T INITIAL_REMAINDER, const T FINAL_XOR_VALUE, const bool REFLECT_DATA, const bool REFLECT_REMAINDER>
-    constexpr T Crc<T, POLYNOMIAL, INITIAL_REMAINDER, FINAL_XOR_VALUE, REFLECT_DATA, REFLECT_REMAINDER>::CRC_TABLE[256];
+    template<class T, const T POLYNOMIAL, const T INITIAL_REMAINDER, const T FINAL_XOR_VALUE, const bool REFLECT_DATA, const bool REFLECT_REMAINDER, const uint32_t SLICES>
+    constexpr T Crc<T, POLYNOMIAL, INITIAL_REMAINDER, FINAL_XOR_VALUE, REFLECT_DATA, REFLECT_REMAINDER, SLICES>::CRC_TABLE[256];
 
     typedef Crc<uint16_t, 0x1021,       0xFFFF,     0x0000,         false,  false>  CrcCcitt;
     typedef Crc<uint16_t, 0x8005,       0x0000,     0x0000,         true,   true>   Crc16;
     typedef Crc<uint32_t, 0x04C11DB7,   0xFFFFFFFF, 0xFFFFFFFF,     true,   true>   Crc32;
+    typedef Crc<uint32_t, 0x1EDC6F41,   0xFFFFFFFF, 0xFFFFFFFF,     true,   true>   Crc32CTable;
+
+    /*!
+        \brief CRC-32C (Castagnoli).
+        \details
+        Uses the SSE4.2 crc32 instruction when the processor supports it, with three independent streams to hide the latency of
+        the instruction. Otherwise the result is calculated with the same tables as Crc32CTable.
+    */
+    class Crc32C : public HashFunction<uint32_t> {
+    public:
+        /*!
+            \brief Static form of Crc32C that can be inlined, see HashFunctionAdapter.
+        */
+        struct Policy {
+            typedef uint32_t HashType;
+
+            static inline HashType Hash(const void* const aValue, const size_t aBytes) throw() {
+                return Crc32CTable::FinalRemainder(Crc32C::UpdateRemainder(Crc32CTable::InitialRemainder(), aValue, aBytes));
+            }
+
+            /*!
+                \brief Calculate the CRC of characters during compilation, gives the same value as Hash.
+            */
+            static constexpr HashType HashChars(const char* const aString, const size_t aBytes) {
+                return Crc32CTable::Policy::HashChars(aString, aBytes);
+            }
+
+            /*!
+                \brief Calculate the CRC of a string literal or char array during compilation, see HashCharsLength.
+            */
+            template<const size_t LENGTH>
+            static constexpr HashType Hash(const char (&aString)[LENGTH]) {
+                return HashChars(aString, HashCharsLength(aString));
+            }
+        };
+
+        class State : public HashState<uint32_t> {
+        private:
+            HashType mRemainder;
+        public:
+            State() throw();
+            SOLAIRE_EXPORT_CALL ~State() throw();
+
+            // Inherited from HashState
+            void SOLAIRE_EXPORT_CALL Initialise() throw() override;
+            void SOLAIRE_EXPORT_CALL Update(const void* const aValue, const size_t aBytes) throw() override;
+            HashType SOLAIRE_EXPORT_CALL Finalise() const throw() override;
+        };
+    public:
+        /*!
+            \brief Process data into a remainder, see Crc::UpdateRemainder.
+        */
+        static HashType UpdateRemainder(const HashType aRemainder, const void* const aValue, const size_t aBytes) throw();
+
+        /*!
+            \brief UpdateRemainder using the tables.
+        */
+        static HashType UpdateRemainderTable(const HashType aRemainder, const void* const aValue, const size_t aBytes) throw();
+
+        /*!
+            \brief UpdateRemainder using the crc32 instruction, the processor must support CPU_SSE4_2.
+            \details Uses the tables on processors that are not x86-64.
+        */
+        static HashType UpdateRemainderHardware(const HashType aRemainder, const void* const aValue, const size_t aBytes) throw();
+
+        /*!
+            \brief Calculate the CRC of two concatenated blocks of data, see Crc::Combine.
+        */
+        static HashType Combine(const HashType aCrcA, const HashType aCrcB, const uint64_t aBytesB) throw();
+
+        /*!
+            \brief Calculate the CRC of data by splitting it between several threads, see Crc::Hash.
+        */
+        HashType Hash(const void* const aValue, const size_t aBytes, const uint32_t aThreads) const throw();
+
+        // Inherited from HashFunction
+        HashType SOLAIRE_EXPORT_CALL Hash(const void* const aValue, const size_t aBytes) const throw() override;
+    };
 }
 
 #endif
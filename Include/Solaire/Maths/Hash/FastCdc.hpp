@@ -0,0 +1,200 @@
+#ifndef SOLAIRE_HASH_FAST_CDC_HPP
+#define SOLAIRE_HASH_FAST_CDC_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file FastCdc.hpp
+	\brief Content defined chunking for deduplication.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 16th October 2026
+	Last Modified	: 16th October 2026
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "Solaire/Core/IStream.hpp"
+#include "HashFunction.hpp"
+#include "XxHash.hpp"
+
+namespace Solaire{
+
+    /*!
+        \brief A chunk found by FastCdc.
+    */
+    struct ContentChunk {
+        uint64_t Offset;    //!< Position of the first byte in the input.
+        uint32_t Bytes;     //!< Length of the chunk.
+        Hash128 Digest;     //!< 128 bit Xxh3 of the chunk's bytes.
+    };
+
+    /*!
+        \brief FastCDC content defined chunking (Xia et al).
+        \details
+        A Gear rolling hash, (hash << 1) + GEAR[byte], is updated for every byte and a chunk ends where the hash has
+        zeros under a mask. Boundaries depend only on nearby content, so data that is inserted or removed only changes the
+        chunks around the edit, unlike fixed size blocks where every later block shifts.
+
+        The first aMinimum bytes of each chunk are skipped without hashing. Before the average size a mask with
+        more bits makes a cut less likely, and after it a mask with fewer bits makes it more likely, which narrows the
+        distribution of chunk sizes around the average (normalised chunking). Two bytes are consumed per iteration.
+    */
+    class FastCdc {
+    public:
+        enum : uint32_t {
+            DEFAULT_MINIMUM = 2048,
+            DEFAULT_AVERAGE = 8192,
+            DEFAULT_MAXIMUM = 65536,
+            SMALLEST_CHUNK  = 64,           //!< The smallest minimum size, the Gear hash sees the last 64 bytes.
+            LARGEST_CHUNK   = 1u << 26      //!< The largest maximum size.
+        };
+    private:
+        enum : size_t {
+            STREAM_READ_BYTES = 1 << 20     //!< The smallest number of bytes read from a stream at a time.
+        };
+
+        static_assert(static_cast<size_t>(LARGEST_CHUNK) <= SIZE_MAX / 2 - STREAM_READ_BYTES, "Solaire::FastCdc : LARGEST_CHUNK is too large for the stream buffer");
+    private:
+        uint64_t mMaskSmall;
+        uint64_t mMaskLarge;
+        uint32_t mMinimum;
+        uint32_t mAverage;
+        uint32_t mMaximum;
+    private:
+        static size_t ReadStream(IStream& aStream, uint8_t* const aBuffer, const size_t aBytes) throw();
+    public:
+        /*!
+            \brief Create a chunker.
+            \details
+            Sizes are clamped to [SMALLEST_CHUNK, LARGEST_CHUNK] and ordered. The average is rounded to a power of two.
+            \param aMinimum The smallest chunk, except for the last chunk of the input.
+            \param aAverage The expected chunk size.
+            \param aMaximum The largest chunk, a cut is forced here.
+            \param aNormalisation The number of mask bits added before and removed after the average size, from 0 to 3.
+        */
+        FastCdc(
+            const uint32_t aMinimum = DEFAULT_MINIMUM,
+            const uint32_t aAverage = DEFAULT_AVERAGE,
+            const uint32_t aMaximum = DEFAULT_MAXIMUM,
+            const uint32_t aNormalisation = 2
+        ) throw();
+
+        uint32_t MinimumSize() const throw();
+        uint32_t AverageSize() const throw();
+        uint32_t MaximumSize() const throw();
+
+        /*!
+            \brief Find the end of the chunk that starts at aData.
+            \details If no boundary is found before aBytes and aBytes is less than the maximum size, aBytes is returned.
+            \return The length of the chunk.
+        */
+        size_t Cut(const void* const aData, const size_t aBytes) const throw();
+
+        /*!
+            \brief Split a block of memory into chunks.
+            \param aCallback Called with (const ContentChunk&, const uint8_t* aChunkData) for each chunk in order.
+            \return The number of chunks.
+        */
+        template<class CALLBACK>
+        uint64_t Split(const void* const aData, const size_t aBytes, CALLBACK aCallback) const {
+            const uint8_t* const data = static_cast<const uint8_t*>(aData);
+            uint64_t count = 0;
+            size_t offset = 0;
+            while(offset < aBytes) {
+                const size_t bytes = Cut(data + offset, aBytes - offset);
+                ContentChunk chunk;
+                chunk.Offset = offset;
+                chunk.Bytes = static_cast<uint32_t>(bytes);
+                chunk.Digest = Xxh3::Hash128WithSeed(data + offset, bytes, 0);
+                aCallback(static_cast<const ContentChunk&>(chunk), data + offset);
+                offset += bytes;
+                ++count;
+            }
+            return count;
+        }
+
+        /*!
+            \brief Split a block of memory into chunks.
+        */
+        std::vector<ContentChunk> Split(const void* const aData, const size_t aBytes) const {
+            std::vector<ContentChunk> chunks;
+            chunks.reserve(aBytes / mAverage + 1);
+            Split(aData, aBytes, [&chunks](const ContentChunk& aChunk, const uint8_t* const) {
+                chunks.push_back(aChunk);
+            });
+            return chunks;
+        }
+
+        /*!
+            \brief Split a stream into chunks, reading until the end of the stream.
+            \details
+            Data is buffered so that a full maximum size chunk is always available to Cut, which gives the same chunks
+            as Split over the whole input in memory. The chunk data passed to the callback is only valid during the call.
+            \param aCallback Called with (const ContentChunk&, const uint8_t* aChunkData) for each chunk in order.
+            \return The number of chunks.
+        */
+        template<class CALLBACK>
+        uint64_t Split(IStream& aStream, CALLBACK aCallback) const {
+            // A full chunk and at least as many bytes again, so each refill reads more than it moves
+            const size_t maximum = static_cast<size_t>(mMaximum);
+            std::vector<uint8_t> buffer(maximum + (maximum > STREAM_READ_BYTES ? maximum : static_cast<size_t>(STREAM_READ_BYTES)));
+            uint8_t* const data = buffer.data();
+            uint64_t count = 0;
+            uint64_t offset = 0;
+            size_t begin = 0;
+            size_t end = 0;
+            bool streamEnd = false;
+
+            while(true) {
+                // Move the unchunked tail to the front and refill
+                if(! streamEnd) {
+                    std::memmove(data, data + begin, end - begin);
+                    end -= begin;
+                    begin = 0;
+                    const size_t bytes = ReadStream(aStream, data + end, buffer.size() - end);
+                    end += bytes;
+                    // A read that makes no progress is treated as the end so that a broken stream cannot loop forever
+                    streamEnd = aStream.end() || bytes == 0;
+                }
+
+                while(end - begin >= mMaximum || (streamEnd && begin < end)) {
+                    const size_t bytes = Cut(data + begin, end - begin);
+                    ContentChunk chunk;
+                    chunk.Offset = offset;
+                    chunk.Bytes = static_cast<uint32_t>(bytes);
+                    chunk.Digest = Xxh3::Hash128WithSeed(data + begin, bytes, 0);
+                    aCallback(static_cast<const ContentChunk&>(chunk), data + begin);
+                    begin += bytes;
+                    offset += bytes;
+                    ++count;
+                }
+
+                if(streamEnd) return count;
+            }
+        }
+    };
+}
+
+#endif
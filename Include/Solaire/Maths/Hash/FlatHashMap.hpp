@@ -0,0 +1,676 @@
+#ifndef SOLAIRE_HASH_FLAT_HASH_MAP_HPP
+#define SOLAIRE_HASH_FLAT_HASH_MAP_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file FlatHashMap.hpp
+	\brief An open addressing hash map that stores its entries in one allocation.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 16th October 2026
+	Last Modified	: 16th October 2026
+*/
+
+#include <cstring>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "HashKey.hpp"
+#include "HashUtility.hpp"
+#include "WyHash.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #define SOLAIRE_FLAT_HASH_MAP_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define SOLAIRE_FLAT_HASH_MAP_SSE2 0
+#endif
+
+namespace Solaire{
+
+    namespace FlatHashMapImplementation {
+
+        enum : int8_t {
+            CONTROL_EMPTY = -128,
+            CONTROL_DELETED = -2
+        };
+
+        enum : size_t {
+            GROUP_SIZE = 16
+        };
+
+        /*!
+            \brief Compares keys of possibly different types with operator==.
+        */
+        struct Equal {
+            template<class A, class B>
+            inline bool operator()(const A& aA, const B& aB) const {
+                return aA == aB;
+            }
+        };
+
+        /*
+            A group is 16 control bytes, one per slot :
+                CONTROL_EMPTY       The slot has never been used since the last rehash.
+                CONTROL_DELETED     The slot held an entry that was erased, probes continue past it.
+                0 to 127            The slot is full, the value is the low 7 bits of the entry's hash.
+            Each Match function returns a mask with bit i set when control byte i matches.
+        */
+        class Group {
+        private:
+#if SOLAIRE_FLAT_HASH_MAP_SSE2
+            __m128i mControl;
+#else
+            int8_t mControl[GROUP_SIZE];
+#endif
+        public:
+            inline Group(const int8_t* const aControl) throw() {
+#if SOLAIRE_FLAT_HASH_MAP_SSE2
+                mControl = _mm_load_si128(reinterpret_cast<const __m128i*>(aControl));
+#else
+                std::memcpy(mControl, aControl, GROUP_SIZE);
+#endif
+            }
+
+            inline uint32_t Match(const int8_t aHash) const throw() {
+#if SOLAIRE_FLAT_HASH_MAP_SSE2
+                return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(mControl, _mm_set1_epi8(aHash))));
+#else
+                uint32_t mask = 0;
+                for(uint32_t i = 0; i < GROUP_SIZE; ++i) mask |= static_cast<uint32_t>(mControl[i] == aHash) << i;
+                return mask;
+#endif
+            }
+
+            inline uint32_t MatchEmpty() const throw() {
+                return Match(CONTROL_EMPTY);
+            }
+
+            inline uint32_t MatchEmptyOrDeleted() const throw() {
+#if SOLAIRE_FLAT_HASH_MAP_SSE2
+                return static_cast<uint32_t>(_mm_movemask_epi8(mControl));
+#else
+                uint32_t mask = 0;
+                for(uint32_t i = 0; i < GROUP_SIZE; ++i) mask |= static_cast<uint32_t>(mControl[i] < 0) << i;
+                return mask;
+#endif
+            }
+        };
+
+        /*!
+            \brief Visits every group once, the step between groups grows by one each time.
+            \details Triangular steps cover every group when the number of groups is a power of two.
+        */
+        class ProbeSequence {
+        private:
+            size_t mMask;
+            size_t mGroup;
+            size_t mStep;
+        public:
+            inline ProbeSequence(const uint64_t aHash, const size_t aGroups) throw() :
+                mMask(aGroups - 1),
+                mGroup(static_cast<size_t>(aHash >> 7) & (aGroups - 1)),
+                mStep(0)
+            {}
+
+            inline size_t Offset() const throw() {
+                return mGroup * GROUP_SIZE;
+            }
+
+            inline void Next() throw() {
+                ++mStep;
+                mGroup = (mGroup + mStep) & mMask;
+            }
+        };
+
+        static inline void Prefetch(const void* const aAddress) throw() {
+#if SOLAIRE_FLAT_HASH_MAP_SSE2
+            _mm_prefetch(static_cast<const char*>(aAddress), _MM_HINT_T0);
+#elif defined(__GNUC__)
+            __builtin_prefetch(aAddress);
+#endif
+        }
+    }
+
+    // m[5] on a uint64_t map must hash the same bytes as Find(uint64_t(5))
+    static_assert(std::is_same<HashKeyLookup<uint64_t, int>::Type, uint64_t>::value, "Solaire::FlatHashMap : keys of other types must be hashed as the key type");
+
+    /*!
+        \brief A hash map that stores its entries in a flat array with a separate array of control bytes.
+        \details
+        Lookups compare 16 control bytes at a time with SSE2, so most of them touch one control group and one entry.
+        The control bytes and entries share a single allocation. The table doubles when it is 7/8 full.
+
+        Lookup functions are templates. A key of another type is converted to KEY before it is hashed and compared,
+        unless both types are transparent (see HashKeyLookup), so a C string can find a std::string without a copy.
+
+        Inserting can move every entry, iterators and pointers are invalidated by insertion, Reserve and Rehash.
+        Erasing only invalidates the erased entry.
+        \tparam KEY The key type, it must not be modified through an iterator.
+        \tparam VALUE The mapped type.
+        \tparam POLICY A hash policy, see HashFunctionAdapter. A 64 bit hash is recommended.
+        \tparam EQUAL Key comparison.
+    */
+    template<class KEY, class VALUE, class POLICY = WyHash::Policy, class EQUAL = FlatHashMapImplementation::Equal>
+    class FlatHashMap {
+    public:
+        typedef KEY KeyType;
+        typedef VALUE MappedType;
+        typedef std::pair<KEY, VALUE> ValueType;
+        typedef POLICY Policy;
+
+        static_assert(alignof(ValueType) <= FlatHashMapImplementation::GROUP_SIZE, "FlatHashMap does not support over-aligned entries");
+
+        template<class ENTRY>
+        class Iterator {
+        private:
+            friend FlatHashMap;
+
+            const int8_t* mControl;
+            ENTRY* mSlot;
+            const int8_t* mEnd;
+        private:
+            void SkipEmpty() throw() {
+                while(mControl != mEnd && *mControl < 0) {
+                    ++mControl;
+                    ++mSlot;
+                }
+            }
+        public:
+            Iterator() throw() :
+                mControl(nullptr),
+                mSlot(nullptr),
+                mEnd(nullptr)
+            {}
+
+            Iterator(const int8_t* const aControl, ENTRY* const aSlot, const int8_t* const aEnd) throw() :
+                mControl(aControl),
+                mSlot(aSlot),
+                mEnd(aEnd)
+            {}
+
+            template<class OTHER, typename = typename std::enable_if<std::is_convertible<OTHER*, ENTRY*>::value>::type>
+            Iterator(const Iterator<OTHER>& aOther) throw() :
+                mControl(aOther.mControl),
+                mSlot(aOther.mSlot),
+                mEnd(aOther.mEnd)
+            {}
+
+            ENTRY& operator*() const throw() {
+                return *mSlot;
+            }
+
+            ENTRY* operator->() const throw() {
+                return mSlot;
+            }
+
+            Iterator& operator++() throw() {
+                ++mControl;
+                ++mSlot;
+                SkipEmpty();
+                return *this;
+            }
+
+            Iterator operator++(int) throw() {
+                const Iterator tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            bool operator==(const Iterator& aOther) const throw() {
+                return mControl == aOther.mControl;
+            }
+
+            bool operator!=(const Iterator& aOther) const throw() {
+                return mControl != aOther.mControl;
+            }
+
+            template<class OTHER>
+            friend class Iterator;
+        };
+
+        typedef Iterator<ValueType> iterator;
+        typedef Iterator<const ValueType> const_iterator;
+    private:
+        enum : size_t {
+            GROUP_SIZE = FlatHashMapImplementation::GROUP_SIZE,
+            BATCH_SIZE = 16
+        };
+    private:
+        int8_t* mControl;
+        ValueType* mSlots;
+        size_t mCapacity;
+        size_t mSize;
+        size_t mGrowthLeft;
+    private:
+        template<class K>
+        static inline uint64_t HashOf(const K& aKey) throw() {
+            return static_cast<uint64_t>(HashKey<POLICY>(aKey));
+        }
+
+        static inline int8_t ControlHash(const uint64_t aHash) throw() {
+            return static_cast<int8_t>(aHash & 0x7F);
+        }
+
+        static inline size_t MaxLoad(const size_t aCapacity) throw() {
+            return aCapacity - aCapacity / 8;
+        }
+
+        static size_t CapacityFor(const size_t aSize) throw() {
+            size_t capacity = GROUP_SIZE;
+            while(MaxLoad(capacity) < aSize) capacity *= 2;
+            return capacity;
+        }
+
+        template<class K>
+        size_t FindIndex(const K& aKey, const uint64_t aHash) const {
+            if(mCapacity == 0) return mCapacity;
+            const int8_t controlHash = ControlHash(aHash);
+            FlatHashMapImplementation::ProbeSequence probe(aHash, mCapacity / GROUP_SIZE);
+            while(true) {
+                const FlatHashMapImplementation::Group group(mControl + probe.Offset());
+                uint32_t matches = group.Match(controlHash);
+                while(matches != 0) {
+                    const size_t index = probe.Offset() + HashUtility::CountTrailingZeros32(matches);
+                    if(EQUAL()(mSlots[index].first, aKey)) return index;
+                    matches &= matches - 1;
+                }
+                if(group.MatchEmpty() != 0) return mCapacity;
+                probe.Next();
+            }
+        }
+
+        template<class K>
+        size_t IndexOf(const K& aKey) const {
+            const typename HashKeyLookup<KEY, K>::Type key = HashKeyLookup<KEY, K>::Get(aKey);
+            return FindIndex(key, HashOf(key));
+        }
+
+        /*!
+            \brief The first empty or deleted slot on a hash's probe sequence.
+        */
+        size_t FindFreeIndex(const uint64_t aHash) const throw() {
+            FlatHashMapImplementation::ProbeSequence probe(aHash, mCapacity / GROUP_SIZE);
+            while(true) {
+                const uint32_t free = FlatHashMapImplementation::Group(mControl + probe.Offset()).MatchEmptyOrDeleted();
+                if(free != 0) return probe.Offset() + HashUtility::CountTrailingZeros32(free);
+                probe.Next();
+            }
+        }
+
+        void Allocate(const size_t aCapacity) {
+            // Control bytes come first, their size is a multiple of 16 so the entries that follow are aligned
+            void* const memory = ::operator new(aCapacity + aCapacity * sizeof(ValueType));
+            mControl = static_cast<int8_t*>(memory);
+            mSlots = reinterpret_cast<ValueType*>(mControl + aCapacity);
+            mCapacity = aCapacity;
+            std::memset(mControl, static_cast<uint8_t>(FlatHashMapImplementation::CONTROL_EMPTY), aCapacity);
+            mGrowthLeft = MaxLoad(aCapacity) - mSize;
+        }
+
+        void DestroyEntries() throw() {
+            for(size_t i = 0; i < mCapacity; ++i) {
+                if(mControl[i] >= 0) mSlots[i].~ValueType();
+            }
+        }
+
+        void Deallocate() throw() {
+            if(mControl) ::operator delete(mControl);
+            mControl = nullptr;
+            mSlots = nullptr;
+            mCapacity = 0;
+            mGrowthLeft = 0;
+        }
+
+        void Resize(const size_t aCapacity) {
+            int8_t* const oldControl = mControl;
+            ValueType* const oldSlots = mSlots;
+            const size_t oldCapacity = mCapacity;
+
+            Allocate(aCapacity);
+            for(size_t i = 0; i < oldCapacity; ++i) {
+                if(oldControl[i] < 0) continue;
+                const uint64_t hash = HashOf(oldSlots[i].first);
+                const size_t index = FindFreeIndex(hash);
+                mControl[index] = ControlHash(hash);
+                new(mSlots + index) ValueType(std::move(oldSlots[i]));
+                oldSlots[i].~ValueType();
+            }
+
+            if(oldControl) ::operator delete(oldControl);
+        }
+
+        /*!
+            \brief Find the slot for a new entry, growing or cleaning the table if needed.
+        */
+        size_t PrepareInsert(const uint64_t aHash) {
+            size_t index = mCapacity == 0 ? 0 : FindFreeIndex(aHash);
+            if(mGrowthLeft == 0 && (mCapacity == 0 || mControl[index] != FlatHashMapImplementation::CONTROL_DELETED)) {
+                // Rehash in place when erased entries use up the load, otherwise double the table
+                Resize(mCapacity == 0 ? GROUP_SIZE : mSize < MaxLoad(mCapacity) / 2 ? mCapacity : mCapacity * 2);
+                index = FindFreeIndex(aHash);
+            }
+            if(mControl[index] == FlatHashMapImplementation::CONTROL_EMPTY) --mGrowthLeft;
+            mControl[index] = ControlHash(aHash);
+            ++mSize;
+            return index;
+        }
+
+        void EraseIndex(const size_t aIndex) throw() {
+            mSlots[aIndex].~ValueType();
+            --mSize;
+
+            // A probe stops at a group with an empty slot, so if this group has one no probe can pass through it
+            const size_t group = aIndex & ~static_cast<size_t>(GROUP_SIZE - 1);
+            if(FlatHashMapImplementation::Group(mControl + group).MatchEmpty() != 0) {
+                mControl[aIndex] = FlatHashMapImplementation::CONTROL_EMPTY;
+                ++mGrowthLeft;
+            }else {
+                mControl[aIndex] = FlatHashMapImplementation::CONTROL_DELETED;
+            }
+        }
+
+        iterator IteratorAt(const size_t aIndex) throw() {
+            return iterator(mControl + aIndex, mSlots + aIndex, mControl + mCapacity);
+        }
+
+        const_iterator IteratorAt(const size_t aIndex) const throw() {
+            return const_iterator(mControl + aIndex, mSlots + aIndex, mControl + mCapacity);
+        }
+    public:
+        FlatHashMap() throw() :
+            mControl(nullptr),
+            mSlots(nullptr),
+            mCapacity(0),
+            mSize(0),
+            mGrowthLeft(0)
+        {}
+
+        /*!
+            \brief Create a map that can hold aSize entries before it needs to grow.
+        */
+        explicit FlatHashMap(const size_t aSize) :
+            FlatHashMap()
+        {
+            Reserve(aSize);
+        }
+
+        FlatHashMap(const FlatHashMap& aOther) :
+            FlatHashMap()
+        {
+            Reserve(aOther.mSize);
+            for(const ValueType& i : aOther) Emplace(i.first, i.second);
+        }
+
+        FlatHashMap(FlatHashMap&& aOther) throw() :
+            mControl(aOther.mControl),
+            mSlots(aOther.mSlots),
+            mCapacity(aOther.mCapacity),
+            mSize(aOther.mSize),
+            mGrowthLeft(aOther.mGrowthLeft)
+        {
+            aOther.mControl = nullptr;
+            aOther.mSlots = nullptr;
+            aOther.mCapacity = 0;
+            aOther.mSize = 0;
+            aOther.mGrowthLeft = 0;
+        }
+
+        ~FlatHashMap() throw() {
+            DestroyEntries();
+            Deallocate();
+        }
+
+        FlatHashMap& operator=(const FlatHashMap& aOther) {
+            if(this != &aOther) {
+                FlatHashMap tmp(aOther);
+                Swap(tmp);
+            }
+            return *this;
+        }
+
+        FlatHashMap& operator=(FlatHashMap&& aOther) throw() {
+            FlatHashMap tmp(std::move(aOther));
+            Swap(tmp);
+            return *this;
+        }
+
+        void Swap(FlatHashMap& aOther) throw() {
+            std::swap(mControl, aOther.mControl);
+            std::swap(mSlots, aOther.mSlots);
+            std::swap(mCapacity, aOther.mCapacity);
+            std::swap(mSize, aOther.mSize);
+            std::swap(mGrowthLeft, aOther.mGrowthLeft);
+        }
+
+        // Capacity
+
+        size_t Size() const throw() {
+            return mSize;
+        }
+
+        bool IsEmpty() const throw() {
+            return mSize == 0;
+        }
+
+        /*!
+            \brief The number of slots in the table, entries are moved when more than 7/8 of them are used.
+        */
+        size_t Capacity() const throw() {
+            return mCapacity;
+        }
+
+        /*!
+            \brief Make sure aSize entries can be held without growing the table.
+        */
+        void Reserve(const size_t aSize) {
+            if(aSize > mSize + mGrowthLeft) Resize(CapacityFor(aSize));
+        }
+
+        /*!
+            \brief Rebuild the table with at least aCapacity slots, which also removes the markers left by erased entries.
+            \details Rehash(0) shrinks the table to the smallest capacity that holds the current entries.
+        */
+        void Rehash(const size_t aCapacity) {
+            size_t capacity = CapacityFor(mSize);
+            while(capacity < aCapacity) capacity *= 2;
+            if(mSize == 0 && aCapacity == 0) {
+                Deallocate();
+            }else {
+                Resize(capacity);
+            }
+        }
+
+        void Clear() throw() {
+            DestroyEntries();
+            mSize = 0;
+            if(mCapacity > 0) {
+                std::memset(mControl, static_cast<uint8_t>(FlatHashMapImplementation::CONTROL_EMPTY), mCapacity);
+                mGrowthLeft = MaxLoad(mCapacity);
+            }
+        }
+
+        // Lookup
+
+        template<class K>
+        iterator Find(const K& aKey) {
+            const size_t index = IndexOf(aKey);
+            return index == mCapacity ? end() : IteratorAt(index);
+        }
+
+        template<class K>
+        const_iterator Find(const K& aKey) const {
+            const size_t index = IndexOf(aKey);
+            return index == mCapacity ? end() : IteratorAt(index);
+        }
+
+        template<class K>
+        bool Contains(const K& aKey) const {
+            return IndexOf(aKey) != mCapacity;
+        }
+
+        /*!
+            \brief Look up many keys, interleaving the memory accesses of different keys.
+            \details
+            Keys are processed 16 at a time. All 16 hashes are calculated and their control groups and first entries
+            prefetched before any are probed, so the cache misses of a batch overlap instead of happening one by one.
+            \param aKeys The keys to look up.
+            \param aCount The number of keys.
+            \param aResults Receives the address of each key's entry, or nullptr if it is not in the map.
+        */
+        template<class K>
+        void FindBatch(const K* const aKeys, const size_t aCount, ValueType** const aResults) {
+            const ValueType** const results = const_cast<const ValueType**>(aResults);
+            static_cast<const FlatHashMap*>(this)->FindBatch(aKeys, aCount, results);
+        }
+
+        template<class K>
+        void FindBatch(const K* const aKeys, const size_t aCount, const ValueType** const aResults) const {
+            typedef HashKeyLookup<KEY, K> Lookup;
+            uint64_t hashes[BATCH_SIZE];
+
+            for(size_t begin = 0; begin < aCount; begin += BATCH_SIZE) {
+                const size_t count = aCount - begin < BATCH_SIZE ? aCount - begin : BATCH_SIZE;
+
+                if(mCapacity > 0) {
+                    for(size_t i = 0; i < count; ++i) {
+                        hashes[i] = HashOf(Lookup::Get(aKeys[begin + i]));
+                        const size_t offset = FlatHashMapImplementation::ProbeSequence(hashes[i], mCapacity / GROUP_SIZE).Offset();
+                        FlatHashMapImplementation::Prefetch(mControl + offset);
+                        FlatHashMapImplementation::Prefetch(mSlots + offset);
+                    }
+                }
+
+                for(size_t i = 0; i < count; ++i) {
+                    const size_t index = mCapacity == 0 ? 0 : FindIndex(Lookup::Get(aKeys[begin + i]), hashes[i]);
+                    aResults[begin + i] = index == mCapacity ? nullptr : mSlots + index;
+                }
+            }
+        }
+
+        /*!
+            \brief Access the value of a key, inserting a default constructed value if it is not in the map.
+        */
+        template<class K>
+        VALUE& operator[](K&& aKey) {
+            return TryEmplace(std::forward<K>(aKey)).first->second;
+        }
+
+        // Modifiers
+
+        /*!
+            \brief Insert a key if it is not already in the map.
+            \details The value is only constructed from aArgs when the key is inserted.
+            \return An iterator to the key's entry, and true if it was inserted.
+        */
+        template<class K, class... ARGS>
+        std::pair<iterator, bool> TryEmplace(K&& aKey, ARGS&&... aArgs) {
+            typedef HashKeyLookup<KEY, typename std::remove_reference<K>::type> Lookup;
+            const typename Lookup::Type key = Lookup::Get(aKey);
+            const uint64_t hash = HashOf(key);
+            const size_t existing = FindIndex(key, hash);
+            if(existing != mCapacity) return std::pair<iterator, bool>(IteratorAt(existing), false);
+
+            const size_t index = PrepareInsert(hash);
+            try{
+                new(mSlots + index) ValueType(
+                    std::piecewise_construct,
+                    std::forward_as_tuple(std::forward<K>(aKey)),
+                    std::forward_as_tuple(std::forward<ARGS>(aArgs)...)
+                );
+            }catch(...) {
+                mControl[index] = FlatHashMapImplementation::CONTROL_DELETED;
+                --mSize;
+                throw;
+            }
+            return std::pair<iterator, bool>(IteratorAt(index), true);
+        }
+
+        template<class K, class V>
+        std::pair<iterator, bool> Emplace(K&& aKey, V&& aValue) {
+            return TryEmplace(std::forward<K>(aKey), std::forward<V>(aValue));
+        }
+
+        std::pair<iterator, bool> Insert(const ValueType& aValue) {
+            return TryEmplace(aValue.first, aValue.second);
+        }
+
+        std::pair<iterator, bool> Insert(ValueType&& aValue) {
+            return TryEmplace(std::move(aValue.first), std::move(aValue.second));
+        }
+
+        /*!
+            \brief Insert a key or replace the value it already has.
+        */
+        template<class K, class V>
+        std::pair<iterator, bool> InsertOrAssign(K&& aKey, V&& aValue) {
+            std::pair<iterator, bool> result = TryEmplace(std::forward<K>(aKey), std::forward<V>(aValue));
+            if(! result.second) result.first->second = std::forward<V>(aValue);
+            return result;
+        }
+
+        /*!
+            \return The number of entries that were erased, 0 or 1.
+        */
+        template<class K>
+        size_t Erase(const K& aKey) {
+            const size_t index = IndexOf(aKey);
+            if(index == mCapacity) return 0;
+            EraseIndex(index);
+            return 1;
+        }
+
+        void Erase(const iterator aPosition) throw() {
+            EraseIndex(static_cast<size_t>(aPosition.mControl - mControl));
+        }
+
+        void Erase(const const_iterator aPosition) throw() {
+            EraseIndex(static_cast<size_t>(aPosition.mControl - mControl));
+        }
+
+        // Iteration
+
+        iterator begin() throw() {
+            iterator i = IteratorAt(0);
+            i.SkipEmpty();
+            return i;
+        }
+
+        const_iterator begin() const throw() {
+            const_iterator i = IteratorAt(0);
+            i.SkipEmpty();
+            return i;
+        }
+
+        iterator end() throw() {
+            return IteratorAt(mCapacity);
+        }
+
+        const_iterator end() const throw() {
+            return IteratorAt(mCapacity);
+        }
+    };
+}
+
+#endif
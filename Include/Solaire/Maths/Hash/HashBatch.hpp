@@ -0,0 +1,230 @@
+#ifndef SOLAIRE_HASH_BATCH_HPP
+#define SOLAIRE_HASH_BATCH_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file HashBatch.hpp
+	\brief Hashes several keys at once by giving each key its own SIMD lane.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 16th October 2026
+	Last Modified	: 16th October 2026
+*/
+
+#include "HashFunction.hpp"
+#include "HashUtility.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #define SOLAIRE_HASH_BATCH_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define SOLAIRE_HASH_BATCH_SSE2 0
+#endif
+
+#if defined(__AVX2__)
+    #define SOLAIRE_HASH_BATCH_AVX2 1
+    #include <immintrin.h>
+#else
+    #define SOLAIRE_HASH_BATCH_AVX2 0
+#endif
+
+namespace Solaire{ namespace HashBatchImplementation{
+
+    /*
+        LANES describes a byte at a time 32 bit hash :
+            INITIAL_HASH                                    The hash of an empty key.
+            static uint32_t Update(uint32_t, const void*, size_t)   Scalar update.
+            static __m128i Step(__m128i, __m128i)           Add one byte (zero extended to 32 bits) to 4 hashes.
+            static __m256i Step(__m256i, __m256i)           Add one byte (zero extended to 32 bits) to 8 hashes.
+    */
+
+    using HashUtility::Read32;
+
+    enum : size_t{
+        MASKED_BYTES = 64   //!< The maximum number of bytes past the end of the shortest key that are hashed in the SIMD lanes.
+    };
+
+    /*!
+        \brief Read up to 4 bytes without branching, the bytes past the end of the key are undefined.
+        \detail Out of range bytes are read from the first byte of the key, so the key must not be empty.
+    */
+    static inline uint32_t ReadPartial32(const uint8_t* const aData, const size_t aOffset, const size_t aLength) throw() {
+        uint32_t tmp = 0;
+        for(size_t i = 0; i < 4; ++i) {
+            const size_t offset = aOffset + i;
+            tmp |= static_cast<uint32_t>(aData[offset < aLength ? offset : 0]) << (i * 8);
+        }
+        return tmp;
+    }
+
+    /*!
+        \brief Describes how far each lane can be hashed with SIMD instructions.
+    */
+    template<const size_t LANES>
+    struct LaneLengths {
+        size_t Shortest;            //!< Every lane has at least this many bytes.
+        size_t End;                 //!< Lanes are hashed with SIMD instructions up to this offset.
+        int32_t Remaining[LANES];   //!< The number of bytes in each lane after the full words of the shortest key.
+        const uint8_t* Keys[LANES]; //!< The keys, with empty keys pointing to a zero byte so that ReadPartial32 is safe.
+
+        LaneLengths(const uint8_t* const* const aKeys, const size_t* const aLengths) throw() {
+            static const uint8_t EMPTY_KEY = 0;
+            size_t shortest = aLengths[0];
+            size_t longest = aLengths[0];
+            for(size_t i = 1; i < LANES; ++i) {
+                if(aLengths[i] < shortest) shortest = aLengths[i];
+                if(aLengths[i] > longest) longest = aLengths[i];
+            }
+            Shortest = shortest - (shortest & 3);
+            End = longest - Shortest < MASKED_BYTES ? longest : Shortest + MASKED_BYTES;
+            for(size_t i = 0; i < LANES; ++i) {
+                const size_t length = aLengths[i] < End ? aLengths[i] : End;
+                Remaining[i] = static_cast<int32_t>(length - Shortest);
+                Keys[i] = aLengths[i] == 0 ? &EMPTY_KEY : aKeys[i];
+            }
+        }
+    };
+
+    template<class LANES, const size_t COUNT>
+    static void FinishLanes(const uint32_t* const aLanes, const uint8_t* const* const aKeys, const size_t* const aLengths, const size_t aOffset, uint32_t* const aHashes) throw() {
+        for(size_t i = 0; i < COUNT; ++i) {
+            aHashes[i] = aLengths[i] > aOffset ?
+                LANES::Update(aLanes[i], aKeys[i] + aOffset, aLengths[i] - aOffset) :
+                aLanes[i];
+        }
+    }
+
+#if SOLAIRE_HASH_BATCH_SSE2
+    template<class LANES>
+    static __m128i MaskedStep(const __m128i aHash, const __m128i aByte, const __m128i aRemaining, const int32_t aOffset) throw() {
+        const __m128i mask = _mm_cmpgt_epi32(aRemaining, _mm_set1_epi32(aOffset));
+        return _mm_or_si128(_mm_and_si128(mask, LANES::Step(aHash, aByte)), _mm_andnot_si128(mask, aHash));
+    }
+
+    template<class LANES>
+    static void HashBatch4(const uint8_t* const* const aKeys, const size_t* const aLengths, uint32_t* const aHashes) throw() {
+        const __m128i mask = _mm_set1_epi32(0xFF);
+        const LaneLengths<4> lengths(aKeys, aLengths);
+        __m128i hash = _mm_set1_epi32(static_cast<int>(LANES::INITIAL_HASH));
+        size_t i = 0;
+
+        // Every lane has at least this many bytes, load 4 bytes per lane and step through them
+        for(; i < lengths.Shortest; i += 4) {
+            const __m128i words = _mm_setr_epi32(
+                static_cast<int>(Read32(aKeys[0] + i)), static_cast<int>(Read32(aKeys[1] + i)),
+                static_cast<int>(Read32(aKeys[2] + i)), static_cast<int>(Read32(aKeys[3] + i))
+            );
+            hash = LANES::Step(hash, _mm_and_si128(words, mask));
+            hash = LANES::Step(hash, _mm_and_si128(_mm_srli_epi32(words, 8), mask));
+            hash = LANES::Step(hash, _mm_and_si128(_mm_srli_epi32(words, 16), mask));
+            hash = LANES::Step(hash, _mm_srli_epi32(words, 24));
+        }
+
+        // Lanes that have run out of bytes keep their hash
+        const __m128i remaining = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lengths.Remaining));
+        for(; i < lengths.End; i += 4) {
+            const __m128i words = _mm_setr_epi32(
+                static_cast<int>(ReadPartial32(lengths.Keys[0], i, aLengths[0])), static_cast<int>(ReadPartial32(lengths.Keys[1], i, aLengths[1])),
+                static_cast<int>(ReadPartial32(lengths.Keys[2], i, aLengths[2])), static_cast<int>(ReadPartial32(lengths.Keys[3], i, aLengths[3]))
+            );
+            const int32_t offset = static_cast<int32_t>(i - lengths.Shortest);
+            hash = MaskedStep<LANES>(hash, _mm_and_si128(words, mask), remaining, offset);
+            hash = MaskedStep<LANES>(hash, _mm_and_si128(_mm_srli_epi32(words, 8), mask), remaining, offset + 1);
+            hash = MaskedStep<LANES>(hash, _mm_and_si128(_mm_srli_epi32(words, 16), mask), remaining, offset + 2);
+            hash = MaskedStep<LANES>(hash, _mm_srli_epi32(words, 24), remaining, offset + 3);
+        }
+
+        uint32_t lanes[4];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), hash);
+        FinishLanes<LANES, 4>(lanes, aKeys, aLengths, lengths.End, aHashes);
+    }
+#endif
+
+#if SOLAIRE_HASH_BATCH_AVX2
+    template<class LANES>
+    static __m256i MaskedStep(const __m256i aHash, const __m256i aByte, const __m256i aRemaining, const int32_t aOffset) throw() {
+        const __m256i mask = _mm256_cmpgt_epi32(aRemaining, _mm256_set1_epi32(aOffset));
+        return _mm256_blendv_epi8(aHash, LANES::Step(aHash, aByte), mask);
+    }
+
+    template<class LANES>
+    static void HashBatch8(const uint8_t* const* const aKeys, const size_t* const aLengths, uint32_t* const aHashes) throw() {
+        const __m256i mask = _mm256_set1_epi32(0xFF);
+        const LaneLengths<8> lengths(aKeys, aLengths);
+        __m256i hash = _mm256_set1_epi32(static_cast<int>(LANES::INITIAL_HASH));
+        size_t i = 0;
+
+        // Every lane has at least this many bytes, load 4 bytes per lane and step through them
+        for(; i < lengths.Shortest; i += 4) {
+            const __m256i words = _mm256_setr_epi32(
+                static_cast<int>(Read32(aKeys[0] + i)), static_cast<int>(Read32(aKeys[1] + i)),
+                static_cast<int>(Read32(aKeys[2] + i)), static_cast<int>(Read32(aKeys[3] + i)),
+                static_cast<int>(Read32(aKeys[4] + i)), static_cast<int>(Read32(aKeys[5] + i)),
+                static_cast<int>(Read32(aKeys[6] + i)), static_cast<int>(Read32(aKeys[7] + i))
+            );
+            hash = LANES::Step(hash, _mm256_and_si256(words, mask));
+            hash = LANES::Step(hash, _mm256_and_si256(_mm256_srli_epi32(words, 8), mask));
+            hash = LANES::Step(hash, _mm256_and_si256(_mm256_srli_epi32(words, 16), mask));
+            hash = LANES::Step(hash, _mm256_srli_epi32(words, 24));
+        }
+
+        // Lanes that have run out of bytes keep their hash
+        const __m256i remaining = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lengths.Remaining));
+        for(; i < lengths.End; i += 4) {
+            const __m256i words = _mm256_setr_epi32(
+                static_cast<int>(ReadPartial32(lengths.Keys[0], i, aLengths[0])), static_cast<int>(ReadPartial32(lengths.Keys[1], i, aLengths[1])),
+                static_cast<int>(ReadPartial32(lengths.Keys[2], i, aLengths[2])), static_cast<int>(ReadPartial32(lengths.Keys[3], i, aLengths[3])),
+                static_cast<int>(ReadPartial32(lengths.Keys[4], i, aLengths[4])), static_cast<int>(ReadPartial32(lengths.Keys[5], i, aLengths[5])),
+                static_cast<int>(ReadPartial32(lengths.Keys[6], i, aLengths[6])), static_cast<int>(ReadPartial32(lengths.Keys[7], i, aLengths[7]))
+            );
+            const int32_t offset = static_cast<int32_t>(i - lengths.Shortest);
+            hash = MaskedStep<LANES>(hash, _mm256_and_si256(words, mask), remaining, offset);
+            hash = MaskedStep<LANES>(hash, _mm256_and_si256(_mm256_srli_epi32(words, 8), mask), remaining, offset + 1);
+            hash = MaskedStep<LANES>(hash, _mm256_and_si256(_mm256_srli_epi32(words, 16), mask), remaining, offset + 2);
+            hash = MaskedStep<LANES>(hash, _mm256_srli_epi32(words, 24), remaining, offset + 3);
+        }
+
+        uint32_t lanes[8];
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), hash);
+        FinishLanes<LANES, 8>(lanes, aKeys, aLengths, lengths.End, aHashes);
+    }
+#endif
+
+    /*!
+        \brief Hash a batch of keys, 8 or 4 at a time when AVX2 or SSE2 is available.
+    */
+    template<class LANES>
+    static void HashBatch(const void* const* const aKeys, const size_t* const aLengths, uint32_t* const aHashes, const size_t aCount) throw() {
+        const uint8_t* const* keys = reinterpret_cast<const uint8_t* const*>(aKeys);
+        size_t i = 0;
+#if SOLAIRE_HASH_BATCH_AVX2
+        for(; i + 8 <= aCount; i += 8) HashBatch8<LANES>(keys + i, aLengths + i, aHashes + i);
+#endif
+#if SOLAIRE_HASH_BATCH_SSE2
+        for(; i + 4 <= aCount; i += 4) HashBatch4<LANES>(keys + i, aLengths + i, aHashes + i);
+#endif
+        for(; i < aCount; ++i) aHashes[i] = LANES::Update(LANES::INITIAL_HASH, keys[i], aLengths[i]);
+    }
+}}
+
+#endif
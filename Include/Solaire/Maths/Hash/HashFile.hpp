@@ -0,0 +1,167 @@
+#ifndef SOLAIRE_HASH_HASH_FILE_HPP
+#define SOLAIRE_HASH_HASH_FILE_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file HashFile.hpp
+	\brief Hash files through memory mappings.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 16th October 2026
+	Last Modified	: 16th October 2026
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include "HashFunction.hpp"
+
+namespace Solaire{
+
+    /*!
+        \brief A read only memory mapping of part or all of a file.
+        \details
+        Mappings are advised for sequential access with read ahead, and for transparent huge pages where the file
+        system supports them. The hints are ignored by systems that do not support them.
+    */
+    class MappedFile {
+    public:
+        enum : size_t {
+            STRIDE_BYTES = 8 * 1024 * 1024     //!< Read ahead is requested this many bytes in front of the data being used.
+        };
+    private:
+        const uint8_t* mData;
+        size_t mMappedBytes;
+        uint64_t mSize;
+#if defined(_WIN32)
+        void* mFile;
+        void* mMapping;
+#else
+        int mFile;
+#endif
+    private:
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+    public:
+        MappedFile() throw();
+        ~MappedFile() throw();
+
+        /*!
+            \brief Open a file for mapping, closing any file that is already open.
+            \return False if the file could not be opened.
+        */
+        bool Open(const char* const aPath) throw();
+        void Close() throw();
+
+        bool IsOpen() const throw();
+
+        /*!
+            \brief The size of the open file in bytes.
+        */
+        uint64_t Size() const throw();
+
+        /*!
+            \brief Map part of the file, replacing the previous mapping.
+            \param aOffset The first byte to map, a multiple of Granularity().
+            \param aBytes The number of bytes to map, which must not go past the end of the file.
+            \return The address of the first byte, or nullptr if the mapping failed.
+        */
+        const uint8_t* Map(const uint64_t aOffset, const size_t aBytes) throw();
+        void Unmap() throw();
+
+        /*!
+            \brief Ask the system to start reading part of the current mapping.
+        */
+        void Prefetch(const uint8_t* const aData, const size_t aBytes) const throw();
+
+        /*!
+            \brief The alignment of mapping offsets.
+        */
+        static size_t Granularity() throw();
+
+        /*!
+            \brief The largest mapping used when a file is processed in windows.
+        */
+        static size_t WindowBytes() throw();
+    };
+
+    /*!
+        \brief Hash a whole file with a single call to aFunction.
+        \details
+        The file is mapped in one piece, so nothing is copied and the system reads the file as the hash consumes it.
+        Mapping a file that is larger than memory is fine on 64 bit systems, but a file larger than the address space
+        fails. Use the HashState form to process files in windows.
+        \param aPath The path of the file.
+        \param aFunction The hash function.
+        \param aHash Receives the hash of the file contents.
+        \return False if the file could not be opened or mapped.
+    */
+    template<class HASH_TYPE>
+    bool HashFile(const char* const aPath, const HashFunction<HASH_TYPE>& aFunction, HASH_TYPE& aHash) throw() {
+        MappedFile file;
+        if(! file.Open(aPath)) return false;
+
+        const uint64_t size = file.Size();
+        if(size == 0) {
+            const uint8_t empty = 0;
+            aHash = aFunction.Hash(&empty, 0);
+            return true;
+        }
+        if(size > static_cast<uint64_t>(SIZE_MAX)) return false;
+
+        const uint8_t* const data = file.Map(0, static_cast<size_t>(size));
+        if(data == nullptr) return false;
+        aHash = aFunction.Hash(data, static_cast<size_t>(size));
+        return true;
+    }
+
+    /*!
+        \brief Add the contents of a file to a hash state.
+        \details
+        The file is mapped in windows of MappedFile::WindowBytes() and each window is given to the state in strides of
+        MappedFile::STRIDE_BYTES, with read ahead requested for the next stride. Only one window is mapped at a time,
+        so files of any size can be hashed. The state is not initialised or finalised.
+        \return False if the file could not be opened or mapped, in which case the state may have been partly updated.
+    */
+    template<class HASH_TYPE>
+    bool HashFile(const char* const aPath, HashState<HASH_TYPE>& aState) throw() {
+        MappedFile file;
+        if(! file.Open(aPath)) return false;
+
+        const uint64_t size = file.Size();
+        const size_t window = MappedFile::WindowBytes();
+        for(uint64_t offset = 0; offset < size; offset += window) {
+            const size_t bytes = static_cast<size_t>(size - offset < window ? size - offset : window);
+            const uint8_t* const data = file.Map(offset, bytes);
+            if(data == nullptr) return false;
+
+            for(size_t i = 0; i < bytes; i += MappedFile::STRIDE_BYTES) {
+                const size_t stride = bytes - i < MappedFile::STRIDE_BYTES ? bytes - i : MappedFile::STRIDE_BYTES;
+                if(i + stride < bytes) file.Prefetch(data + i + stride, bytes - i - stride < MappedFile::STRIDE_BYTES ? bytes - i - stride : MappedFile::STRIDE_BYTES);
+                aState.Update(data + i, stride);
+            }
+        }
+        return true;
+    }
+}
+
+#endif
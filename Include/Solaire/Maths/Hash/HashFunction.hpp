@@ -28,13 +28,38 @@ Last modified	: Adam Smith
 \version 1.0
 \date
 Created			: 1st October 2015
-Last Modified	: 5th January 2016
+Last Modified	: 16th October 2026
 */
 
 #include "Solaire\Core\ModuleHeader.hpp"
 
 namespace Solaire{
 
+    /*!
+        \brief A 128 bit hash value.
+    */
+    struct Hash128 {
+        uint64_t Low;
+        uint64_t High;
+
+        inline bool operator==(const Hash128 aOther) const throw() {
+            return Low == aOther.Low && High == aOther.High;
+        }
+
+        inline bool operator!=(const Hash128 aOther) const throw() {
+            return Low != aOther.Low || High != aOther.High;
+        }
+    };
+
+    /*!
+        \brief The number of characters of a char array that are hashed by the constexpr Hash of a policy.
+        \details A string literal's terminating null character is not hashed, arrays that do not end with one are hashed in full.
+    */
+    template<const size_t LENGTH>
+    static constexpr size_t HashCharsLength(const char (&aString)[LENGTH]) {
+        return aString[LENGTH - 1] == '\0' ? LENGTH - 1 : LENGTH;
+    }
+
     template<class HASH_TYPE, typename Enable = typename std::enable_if<std::is_unsigned<HASH_TYPE>::value, void>::type>
     SOLAIRE_EXPORT_INTERFACE HashFunction{
     public:
@@ -42,6 +67,79 @@ namespace Solaire{
 
         virtual SOLAIRE_EXPORT_CALL ~HashFunction() throw() = 0;
         virtual HashType SOLAIRE_EXPORT_CALL Hash(const void* const aValue, const size_t aBytes) const throw() = 0;
+
+        /*!
+            \brief Hash several independent keys.
+            \details Implementations may override this to hash several keys in parallel.
+            \param aKeys The address of each key.
+            \param aLengths The length of each key in bytes.
+            \param aHashes Receives the hash of each key.
+            \param aCount The number of keys.
+        */
+        virtual void SOLAIRE_EXPORT_CALL HashBatch(const void* const* const aKeys, const size_t* const aLengths, HashType* const aHashes, const size_t aCount) const throw() {
+            for(size_t i = 0; i < aCount; ++i) aHashes[i] = Hash(aKeys[i], aLengths[i]);
+        }
+    };
+
+    template<class HASH_TYPE, typename Enable>
+    SOLAIRE_EXPORT_CALL HashFunction<HASH_TYPE, Enable>::~HashFunction() throw() {
+
+    }
+
+    /*!
+        \brief The intermediate state of a hash that is calculated incrementally.
+        \details
+        Data can be passed to Update in any number of pieces, the result of Finalise is the same as
+        if all of the data had been passed to HashFunction::Hash in a single buffer.
+    */
+    template<class HASH_TYPE, typename Enable = typename std::enable_if<std::is_unsigned<HASH_TYPE>::value, void>::type>
+    SOLAIRE_EXPORT_INTERFACE HashState{
+    public:
+        typedef HASH_TYPE HashType;
+
+        virtual SOLAIRE_EXPORT_CALL ~HashState() throw() = 0;
+
+        /*!
+            \brief Discard all data that has been hashed so far.
+        */
+        virtual void SOLAIRE_EXPORT_CALL Initialise() throw() = 0;
+
+        /*!
+            \brief Add data to the hash.
+            \param aValue The address of the data.
+            \param aBytes The number of bytes to add.
+        */
+        virtual void SOLAIRE_EXPORT_CALL Update(const void* const aValue, const size_t aBytes) throw() = 0;
+
+        /*!
+            \brief Calculate the hash of all data added since the last call to Initialise.
+            \details The state is not modified, more data can still be added after this call.
+            \return The hash value.
+        */
+        virtual HashType SOLAIRE_EXPORT_CALL Finalise() const throw() = 0;
+    };
+
+    template<class HASH_TYPE, typename Enable>
+    SOLAIRE_EXPORT_CALL HashState<HASH_TYPE, Enable>::~HashState() throw() {
+
+    }
+
+    /*!
+        \brief Exposes a static hash policy through the virtual HashFunction interface.
+        \details
+        A policy is a type with a HashType typedef and a static HashType Hash(const void* const, const size_t) function,
+        each hash function provides one as its nested Policy type. Templates that take a policy can inline the hash,
+        the adapter is only needed when a HashFunction is required.
+    */
+    template<class POLICY>
+    class HashFunctionAdapter : public HashFunction<typename POLICY::HashType> {
+    public:
+        typedef POLICY Policy;
+
+        // Inherited from HashFunction
+        typename POLICY::HashType SOLAIRE_EXPORT_CALL Hash(const void* const aValue, const size_t aBytes) const throw() override {
+            return POLICY::Hash(aValue, aBytes);
+        }
     };
 
 }
@@ -0,0 +1,153 @@
+#ifndef SOLAIRE_HASH_HASH_KEY_HPP
+#define SOLAIRE_HASH_HASH_KEY_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file HashKey.hpp
+	\brief Hashing of typed keys with a hash policy.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 16th October 2026
+	Last Modified	: 16th October 2026
+*/
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include "HashFunction.hpp"
+
+namespace Solaire{
+
+    /*!
+        \brief Describes the bytes of a key that are passed to a hash policy.
+        \details
+        Keys that compare equal must produce the same bytes. The default hashes the object representation, which is
+        only suitable for types without padding. std::string and C strings hash their characters, see HashKeyTransparent.
+    */
+    template<class KEY, class ENABLE = void>
+    struct HashKeyBytes {
+        static_assert(std::is_trivially_copyable<KEY>::value, "HashKeyBytes must be specialised for this key type");
+
+        static inline const void* Data(const KEY& aKey) throw() {
+            return &aKey;
+        }
+
+        static inline size_t Bytes(const KEY&) throw() {
+            return sizeof(KEY);
+        }
+    };
+
+    template<class CHAR, class TRAITS, class ALLOCATOR>
+    struct HashKeyBytes<std::basic_string<CHAR, TRAITS, ALLOCATOR>> {
+        static inline const void* Data(const std::basic_string<CHAR, TRAITS, ALLOCATOR>& aKey) throw() {
+            return aKey.data();
+        }
+
+        static inline size_t Bytes(const std::basic_string<CHAR, TRAITS, ALLOCATOR>& aKey) throw() {
+            return aKey.size() * sizeof(CHAR);
+        }
+    };
+
+    template<>
+    struct HashKeyBytes<const char*> {
+        static inline const void* Data(const char* const aKey) throw() {
+            return aKey;
+        }
+
+        static inline size_t Bytes(const char* const aKey) throw() {
+            return std::strlen(aKey);
+        }
+    };
+
+    template<>
+    struct HashKeyBytes<char*> : public HashKeyBytes<const char*> {};
+
+    template<const size_t LENGTH>
+    struct HashKeyBytes<char[LENGTH]> : public HashKeyBytes<const char*> {};
+
+    /*!
+        \brief Hash a key with a policy, see HashKeyBytes and HashFunctionAdapter.
+    */
+    template<class POLICY, class KEY>
+    static inline typename POLICY::HashType HashKey(const KEY& aKey) throw() {
+        return POLICY::Hash(HashKeyBytes<KEY>::Data(aKey), HashKeyBytes<KEY>::Bytes(aKey));
+    }
+
+    /*!
+        \brief Key types whose HashKeyBytes are the same as those of every other transparent type with an equal value.
+        \details
+        A transparent key can be hashed as it is to find an equal key of another transparent type, so a C string can be
+        used to find a std::string without being copied. Types must opt in by specialising this template.
+    */
+    template<class KEY>
+    struct HashKeyTransparent : public std::false_type {};
+
+    template<class TRAITS, class ALLOCATOR>
+    struct HashKeyTransparent<std::basic_string<char, TRAITS, ALLOCATOR>> : public std::true_type {};
+
+    template<>
+    struct HashKeyTransparent<const char*> : public std::true_type {};
+
+    template<>
+    struct HashKeyTransparent<char*> : public std::true_type {};
+
+    template<const size_t LENGTH>
+    struct HashKeyTransparent<char[LENGTH]> : public std::true_type {};
+
+    /*!
+        \brief The form of an OTHER that is hashed and compared when it is used to find a KEY.
+        \details
+        OTHER is used as it is when it is KEY, or when both types are transparent. Otherwise it is implicitly converted
+        to KEY first, so an int used to find a uint64_t key hashes the same 8 bytes as the stored key.
+    */
+    template<class KEY, class OTHER, const bool AS_IS =
+        std::is_same<KEY, typename std::remove_cv<OTHER>::type>::value ||
+        (HashKeyTransparent<KEY>::value && HashKeyTransparent<typename std::remove_cv<OTHER>::type>::value)
+    >
+    struct HashKeyLookup {
+        typedef const OTHER& Type;
+
+        static inline const OTHER& Get(const OTHER& aKey) throw() {
+            return aKey;
+        }
+    };
+
+    template<class KEY, class OTHER>
+    struct HashKeyLookup<KEY, OTHER, false> {
+        typedef KEY Type;
+
+        static inline KEY Get(const OTHER& aKey) {
+            return aKey;
+        }
+    };
+
+    /*!
+        \brief Hash a key as the key type KEY, see HashKeyLookup.
+    */
+    template<class POLICY, class KEY, class OTHER>
+    static inline typename POLICY::HashType HashKeyAs(const OTHER& aKey) {
+        return HashKey<POLICY>(HashKeyLookup<KEY, OTHER>::Get(aKey));
+    }
+}
+
+#endif
@@ -0,0 +1,126 @@
+#ifndef SOLAIRE_HASH_UTILITY_HPP
+#define SOLAIRE_HASH_UTILITY_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file HashUtility.hpp
+	\brief Word reads and multiplies shared by the 64 bit hash functions.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 16th October 2026
+	Last Modified	: 16th October 2026
+*/
+
+#include <cstdint>
+#include <cstring>
+#include "..\BitScan.hpp"
+
+#if defined(_MSC_VER) && defined(_M_X64)
+    #include <intrin.h>
+#endif
+
+namespace Solaire{ namespace HashUtility{
+
+    // Hashes are defined on little endian data, as with Sum the words are read in native order
+
+    static inline uint64_t Read64(const uint8_t* const aData) throw() {
+        uint64_t tmp;
+        std::memcpy(&tmp, aData, sizeof(uint64_t));
+        return tmp;
+    }
+
+    static inline uint32_t Read32(const uint8_t* const aData) throw() {
+        uint32_t tmp;
+        std::memcpy(&tmp, aData, sizeof(uint32_t));
+        return tmp;
+    }
+
+    /*!
+        \brief Read 0 to 8 bytes into the low bytes of a word without a loop.
+        \details Reads of 4 or more bytes overlap, the overlapping bytes land in the same position so they can be ORed together.
+    */
+    static inline uint64_t ReadPartial64(const uint8_t* const aData, const size_t aBytes) throw() {
+        if(aBytes >= 4) {
+            return static_cast<uint64_t>(Read32(aData)) | (static_cast<uint64_t>(Read32(aData + aBytes - 4)) << ((aBytes - 4) * 8));
+        }else if(aBytes > 0) {
+            return
+                static_cast<uint64_t>(aData[0]) |
+                (static_cast<uint64_t>(aData[aBytes >> 1]) << ((aBytes >> 1) * 8)) |
+                (static_cast<uint64_t>(aData[aBytes - 1]) << ((aBytes - 1) * 8));
+        }else {
+            return 0;
+        }
+    }
+
+    static inline uint64_t RotateLeft64(const uint64_t aValue, const uint32_t aBits) throw() {
+        return (aValue << aBits) | (aValue >> (64 - aBits));
+    }
+
+    static inline uint32_t RotateLeft32(const uint32_t aValue, const uint32_t aBits) throw() {
+        return (aValue << aBits) | (aValue >> (32 - aBits));
+    }
+
+    /*!
+        \brief The index of the lowest set bit, aValue must not be 0.
+    */
+    static inline uint32_t CountTrailingZeros32(const uint32_t aValue) throw() {
+        return scanTrailingZeros32(aValue);
+    }
+
+    static inline uint32_t ByteSwap32(const uint32_t aValue) throw() {
+        return (aValue << 24) | ((aValue << 8) & 0xFF0000) | ((aValue >> 8) & 0xFF00) | (aValue >> 24);
+    }
+
+    static inline uint64_t ByteSwap64(const uint64_t aValue) throw() {
+        return (static_cast<uint64_t>(ByteSwap32(static_cast<uint32_t>(aValue))) << 32) | ByteSwap32(static_cast<uint32_t>(aValue >> 32));
+    }
+
+    /*!
+        \brief The full 128 bit product of two 64 bit values.
+    */
+    static inline void Multiply128(const uint64_t aA, const uint64_t aB, uint64_t& aLow, uint64_t& aHigh) throw() {
+#if defined(__SIZEOF_INT128__)
+        const unsigned __int128 product = static_cast<unsigned __int128>(aA) * aB;
+        aLow = static_cast<uint64_t>(product);
+        aHigh = static_cast<uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+        aLow = _umul128(aA, aB, &aHigh);
+#else
+        const uint64_t loLo = (aA & 0xFFFFFFFF) * (aB & 0xFFFFFFFF);
+        const uint64_t hiLo = (aA >> 32) * (aB & 0xFFFFFFFF);
+        const uint64_t loHi = (aA & 0xFFFFFFFF) * (aB >> 32);
+        const uint64_t hiHi = (aA >> 32) * (aB >> 32);
+        const uint64_t cross = (loLo >> 32) + (hiLo & 0xFFFFFFFF) + loHi;
+        aLow = (cross << 32) | (loLo & 0xFFFFFFFF);
+        aHigh = (hiLo >> 32) + (cross >> 32) + hiHi;
+#endif
+    }
+
+    static inline uint64_t MultiplyFold64(const uint64_t aA, const uint64_t aB) throw() {
+        uint64_t low, high;
+        Multiply128(aA, aB, low, high);
+        return low ^ high;
+    }
+}}
+
+#endif
@@ -0,0 +1,119 @@
+#ifndef SOLAIRE_HASH_MULTI_CHECKSUM_HPP
+#define SOLAIRE_HASH_MULTI_CHECKSUM_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file MultiChecksum.hpp
+	\brief Calculate several checksums in one pass over the data.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 16th October 2026
+	Last Modified	: 16th October 2026
+*/
+
+#include "Addler.hpp"
+#include "Crc.hpp"
+#include "XxHash.hpp"
+
+namespace Solaire{
+
+    namespace MultiChecksumImplementation {
+        enum : size_t{
+            CHUNK_SIZE = 4096   //!< Small enough that a chunk is still in the L1 cache when the last state reads it
+        };
+
+        static inline void UpdateStates(const uint8_t* const, const size_t) throw() {
+
+        }
+
+        template<class STATE, class... STATES>
+        static inline void UpdateStates(const uint8_t* const aData, const size_t aBytes, STATE& aState, STATES&... aStates) throw() {
+            aState.Update(aData, aBytes);
+            UpdateStates(aData, aBytes, aStates...);
+        }
+    }
+
+    /*!
+        \brief Update several hash states with the same data while reading it from memory once.
+        \details
+        The data is given to every state one chunk at a time, so after the first state has read a chunk from memory
+        the others read it from the L1 cache. The states are left in the same condition as if each had been updated with
+        the whole of the data.
+        \param aValue The address of the data.
+        \param aBytes The number of bytes to process.
+        \param aStates The HashState objects to update.
+    */
+    template<class... STATES>
+    static void UpdateFused(const void* const aValue, const size_t aBytes, STATES&... aStates) throw() {
+        const uint8_t* data = static_cast<const uint8_t*>(aValue);
+        size_t bytes = aBytes;
+
+        while(bytes > MultiChecksumImplementation::CHUNK_SIZE) {
+            MultiChecksumImplementation::UpdateStates(data, MultiChecksumImplementation::CHUNK_SIZE, aStates...);
+            data += MultiChecksumImplementation::CHUNK_SIZE;
+            bytes -= MultiChecksumImplementation::CHUNK_SIZE;
+        }
+        MultiChecksumImplementation::UpdateStates(data, bytes, aStates...);
+    }
+
+    struct Checksums {
+        uint32_t Crc;       //!< Crc32
+        uint32_t Addler;    //!< Addler32
+        uint64_t Hash64;    //!< Xxh3
+
+        inline bool operator==(const Checksums aOther) const throw() {
+            return Crc == aOther.Crc && Addler == aOther.Addler && Hash64 == aOther.Hash64;
+        }
+
+        inline bool operator!=(const Checksums aOther) const throw() {
+            return ! operator==(aOther);
+        }
+    };
+
+    /*!
+        \brief Crc32, Addler32 and Xxh3 of the same data, calculated in one pass with UpdateFused.
+        \details Each checksum is the same as the value calculated by its own hash function.
+    */
+    class MultiChecksum {
+    private:
+        Crc32::State mCrc;
+        Addler32::State mAddler;
+        Xxh3::State mHash64;
+    public:
+        /*!
+            \param aSeed The seed of the Xxh3 hash.
+        */
+        MultiChecksum(const uint64_t aSeed = 0) throw();
+
+        void Initialise() throw();
+        void Update(const void* const aValue, const size_t aBytes) throw();
+        Checksums Finalise() const throw();
+
+        /*!
+            \brief Calculate every checksum of a block of data.
+        */
+        static Checksums Hash(const void* const aValue, const size_t aBytes, const uint64_t aSeed = 0) throw();
+    };
+}
+
+#endif
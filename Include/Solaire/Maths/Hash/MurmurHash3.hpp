@@ -0,0 +1,151 @@
+#ifndef SOLAIRE_HASH_MURMUR_HASH_3_HPP
+#define SOLAIRE_HASH_MURMUR_HASH_3_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file MurmurHash3.hpp
+	\brief MurmurHash3_x64_128.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 16th October 2026
+	Last Modified	: 16th October 2026
+*/
+
+#include "HashFunction.hpp"
+#include "HashUtility.hpp"
+
+namespace Solaire{
+
+    /*!
+        \brief MurmurHash3_x64_128, processes 16 bytes at a time in two 64 bit lanes.
+        \details HashFunction::Hash returns the first 64 bits of the 128 bit hash.
+    */
+    class MurmurHash3 : public HashFunction<uint64_t>
+    {
+    private:
+        enum : uint64_t{
+            C1 = 0x87c37b91114253d5ULL,
+            C2 = 0x4cf5ad432745937fULL
+        };
+
+        static inline uint64_t MixK1(const uint64_t aK1) throw() {
+            return HashUtility::RotateLeft64(aK1 * C1, 31) * C2;
+        }
+
+        static inline uint64_t MixK2(const uint64_t aK2) throw() {
+            return HashUtility::RotateLeft64(aK2 * C2, 33) * C1;
+        }
+
+        static inline uint64_t FinalMix(uint64_t aHash) throw() {
+            aHash ^= aHash >> 33;
+            aHash *= 0xff51afd7ed558ccdULL;
+            aHash ^= aHash >> 33;
+            aHash *= 0xc4ceb9fe1a85ec53ULL;
+            return aHash ^ (aHash >> 33);
+        }
+
+        static inline void Block(uint64_t& aH1, uint64_t& aH2, const uint64_t aK1, const uint64_t aK2) throw() {
+            using namespace HashUtility;
+            aH1 ^= MixK1(aK1);
+            aH1 = RotateLeft64(aH1, 27) + aH2;
+            aH1 = aH1 * 5 + 0x52dce729;
+            aH2 ^= MixK2(aK2);
+            aH2 = RotateLeft64(aH2, 31) + aH1;
+            aH2 = aH2 * 5 + 0x38495ab5;
+        }
+    public:
+        /*!
+            \brief Calculate the 128 bit MurmurHash3 of data.
+            \param aValue The address of the data.
+            \param aBytes The number of bytes to hash.
+            \param aSeed Selects one of 2^32 different hash functions, the reference implementation only takes a 32 bit seed.
+        */
+        static inline Hash128 Hash128WithSeed(const void* const aValue, const size_t aBytes, const uint32_t aSeed) throw() {
+            using namespace HashUtility;
+            const uint8_t* const data = static_cast<const uint8_t*>(aValue);
+            uint64_t h1 = aSeed;
+            uint64_t h2 = aSeed;
+
+            const size_t blockBytes = aBytes & ~static_cast<size_t>(15);
+            for(size_t i = 0; i < blockBytes; i += 16) {
+                Block(h1, h2, Read64(data + i), Read64(data + i + 8));
+            }
+
+            // The tail is read in two partial words rather than the reference byte switch
+            const uint8_t* const tail = data + blockBytes;
+            const size_t tailBytes = aBytes & 15;
+            if(tailBytes > 8) {
+                h2 ^= MixK2(ReadPartial64(tail + 8, tailBytes - 8));
+                h1 ^= MixK1(Read64(tail));
+            }else if(tailBytes > 0) {
+                h1 ^= MixK1(ReadPartial64(tail, tailBytes));
+            }
+
+            h1 ^= aBytes;
+            h2 ^= aBytes;
+            h1 += h2;
+            h2 += h1;
+            h1 = FinalMix(h1);
+            h2 = FinalMix(h2);
+            h1 += h2;
+            h2 += h1;
+
+            Hash128 hash;
+            hash.Low = h1;
+            hash.High = h2;
+            return hash;
+        }
+
+        /*!
+            \brief Calculate the first 64 bits of the MurmurHash3 of data.
+        */
+        static inline HashType HashWithSeed(const void* const aValue, const size_t aBytes, const uint32_t aSeed) throw() {
+            return Hash128WithSeed(aValue, aBytes, aSeed).Low;
+        }
+
+        /*!
+            \brief Static form of MurmurHash3 with a seed of 0 that can be inlined, see HashFunctionAdapter.
+        */
+        struct Policy {
+            typedef uint64_t HashType;
+
+            static inline HashType Hash(const void* const aValue, const size_t aBytes) throw() {
+                return MurmurHash3::HashWithSeed(aValue, aBytes, 0);
+            }
+        };
+    private:
+        uint32_t mSeed;
+    public:
+        MurmurHash3(const uint32_t aSeed = 0) throw();
+
+        /*!
+            \brief Calculate the 128 bit MurmurHash3 of data with this function's seed.
+        */
+        Hash128 Hash128Of(const void* const aValue, const size_t aBytes) const throw();
+
+        // Inherited from HashFunction
+        HashType SOLAIRE_EXPORT_CALL Hash(const void* const aValue, const size_t aBytes) const throw() override;
+    };
+}
+
+#endif
@@ -37,9 +37,71 @@ namespace Solaire{
 
     class Sdbm : public HashFunction<uint32_t>
     {
+    public:
+        /*!
+            \brief Static form of Sdbm that can be inlined, see HashFunctionAdapter.
+        */
+        struct Policy {
+            typedef uint32_t HashType;
+
+            enum : HashType{
+                INITIAL_HASH = 0
+            };
+
+            static inline HashType Update(HashType aHash, const void* const aValue, const size_t aBytes) throw() {
+                const uint8_t* const data = static_cast<const uint8_t*>(aValue);
+                for(size_t i = 0; i < aBytes; ++i){
+                    aHash = data[i] + (aHash << 6) + (aHash << 16) - aHash;
+                }
+                return aHash;
+            }
+
+            static inline HashType Hash(const void* const aValue, const size_t aBytes) throw() {
+                return Update(INITIAL_HASH, aValue, aBytes);
+            }
+
+            /*!
+                \brief Add characters to a hash during compilation, gives the same value as Update.
+            */
+            static constexpr HashType UpdateChars(HashType aHash, const char* const aString, const size_t aBytes) {
+                for(size_t i = 0; i < aBytes; ++i){
+                    aHash = static_cast<uint8_t>(aString[i]) + (aHash << 6) + (aHash << 16) - aHash;
+                }
+                return aHash;
+            }
+
+            /*!
+                \brief Hash characters during compilation, gives the same value as Hash.
+            */
+            static constexpr HashType HashChars(const char* const aString, const size_t aBytes) {
+                return UpdateChars(INITIAL_HASH, aString, aBytes);
+            }
+
+            /*!
+                \brief Hash a string literal or char array during compilation, see HashCharsLength.
+            */
+            template<const size_t LENGTH>
+            static constexpr HashType Hash(const char (&aString)[LENGTH]) {
+                return HashChars(aString, HashCharsLength(aString));
+            }
+        };
+
+        class State : public HashState<uint32_t> {
+        private:
+            HashType mHash;
+        public:
+            State() throw();
+            SOLAIRE_EXPORT_CALL ~State() throw();
+
+            // Inherited from HashState
+            void SOLAIRE_EXPORT_CALL Initialise() throw() override;
+            void SOLAIRE_EXPORT_CALL Update(const void* const aValue, const size_t aBytes) throw() override;
+            HashType SOLAIRE_EXPORT_CALL Finalise() const throw() override;
+        };
     public:
         // Inherited from HashFunction
 		HashType SOLAIRE_EXPORT_CALL Hash(const void* const aValue, const size_t aBytes) const throw() override;
+		void SOLAIRE_EXPORT_CALL HashBatch(const void* const* const aKeys, const size_t* const aLengths, HashType* const aHashes, const size_t aCount) const throw() override;
     };
 }
 
@@ -0,0 +1,231 @@
+#ifndef SOLAIRE_HASH_SIPHASH_HPP
+#define SOLAIRE_HASH_SIPHASH_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file SipHash.hpp
+	\brief Keyed SipHash for hash tables that store untrusted keys.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 16th October 2026
+	Last Modified	: 16th October 2026
+*/
+
+#include "HashFunction.hpp"
+#include "HashUtility.hpp"
+
+namespace Solaire{
+
+    /*!
+        \brief The 128 bit secret key of a SipHash.
+    */
+    struct SipHashKey {
+        uint64_t K0;    //!< Bytes 0 to 7 of the key, little endian.
+        uint64_t K1;    //!< Bytes 8 to 15 of the key, little endian.
+    };
+
+    namespace SipHashImplementation {
+        /*!
+            \brief Generate a key from the system's random device.
+            \details If no random device is available the key is derived from the clock and address space layout.
+        */
+        SipHashKey RandomKey() throw();
+    }
+
+    /*!
+        \brief SipHash-C-D, a keyed hash that an attacker cannot find collisions for without knowing the key.
+        \details
+        C_ROUNDS rounds are applied to each 8 byte block and D_ROUNDS rounds to finalise.
+        SipHash-2-4 is the conservative original, SipHash-1-3 is faster and is what most hash table implementations use.
+    */
+    template<const uint32_t C_ROUNDS, const uint32_t D_ROUNDS>
+    class SipHash : public HashFunction<uint64_t>
+    {
+    private:
+        struct Lanes {
+            uint64_t V0;
+            uint64_t V1;
+            uint64_t V2;
+            uint64_t V3;
+
+            inline Lanes(const SipHashKey& aKey) throw() :
+                V0(aKey.K0 ^ 0x736f6d6570736575ULL),
+                V1(aKey.K1 ^ 0x646f72616e646f6dULL),
+                V2(aKey.K0 ^ 0x6c7967656e657261ULL),
+                V3(aKey.K1 ^ 0x7465646279746573ULL)
+            {}
+
+            inline void Round() throw() {
+                using namespace HashUtility;
+                V0 += V1; V1 = RotateLeft64(V1, 13); V1 ^= V0; V0 = RotateLeft64(V0, 32);
+                V2 += V3; V3 = RotateLeft64(V3, 16); V3 ^= V2;
+                V0 += V3; V3 = RotateLeft64(V3, 21); V3 ^= V0;
+                V2 += V1; V1 = RotateLeft64(V1, 17); V1 ^= V2; V2 = RotateLeft64(V2, 32);
+            }
+
+            inline void Compress(const uint64_t aBlock) throw() {
+                V3 ^= aBlock;
+                for(uint32_t i = 0; i < C_ROUNDS; ++i) Round();
+                V0 ^= aBlock;
+            }
+
+            /*!
+                \brief Add whole 8 byte blocks.
+                \return The number of bytes that were processed.
+            */
+            inline size_t CompressBlocks(const uint8_t* const aData, const size_t aBytes) throw() {
+                const size_t blockBytes = aBytes & ~static_cast<size_t>(7);
+                for(size_t i = 0; i < blockBytes; i += 8) Compress(HashUtility::Read64(aData + i));
+                return blockBytes;
+            }
+
+            /*!
+                \brief Add the last 0 to 7 bytes and the total length, then calculate the hash.
+            */
+            inline uint64_t Finalise(const uint8_t* const aTail, const size_t aTailBytes, const uint64_t aTotalBytes) throw() {
+                Compress(HashUtility::ReadPartial64(aTail, aTailBytes) | (aTotalBytes << 56));
+                V2 ^= 0xFF;
+                for(uint32_t i = 0; i < D_ROUNDS; ++i) Round();
+                return V0 ^ V1 ^ V2 ^ V3;
+            }
+        };
+    public:
+        /*!
+            \brief The key used by default constructed hash functions and Policy.
+            \details The key is generated randomly the first time it is needed and does not change until the process exits.
+        */
+        static const SipHashKey& ProcessKey() throw() {
+            static const SipHashKey KEY = SipHashImplementation::RandomKey();
+            return KEY;
+        }
+
+        /*!
+            \brief Calculate the SipHash of data.
+            \param aValue The address of the data.
+            \param aBytes The number of bytes to hash.
+            \param aKey The secret key.
+        */
+        static inline HashType HashWithKey(const void* const aValue, const size_t aBytes, const SipHashKey& aKey) throw() {
+            const uint8_t* const data = static_cast<const uint8_t*>(aValue);
+            Lanes lanes(aKey);
+            const size_t offset = lanes.CompressBlocks(data, aBytes);
+            return lanes.Finalise(data + offset, aBytes - offset, aBytes);
+        }
+
+        /*!
+            \brief Static form of SipHash with the process key that can be inlined, see HashFunctionAdapter.
+        */
+        struct Policy {
+            typedef uint64_t HashType;
+
+            static inline HashType Hash(const void* const aValue, const size_t aBytes) throw() {
+                return SipHash::HashWithKey(aValue, aBytes, SipHash::ProcessKey());
+            }
+        };
+
+        class State : public HashState<uint64_t> {
+        private:
+            Lanes mLanes;
+            SipHashKey mKey;
+            uint64_t mTotalBytes;
+            uint8_t mBuffer[8];
+            uint32_t mBufferedBytes;
+        public:
+            State() throw() :
+                mLanes(ProcessKey()),
+                mKey(ProcessKey()),
+                mTotalBytes(0),
+                mBufferedBytes(0)
+            {}
+
+            State(const SipHashKey& aKey) throw() :
+                mLanes(aKey),
+                mKey(aKey),
+                mTotalBytes(0),
+                mBufferedBytes(0)
+            {}
+
+            SOLAIRE_EXPORT_CALL ~State() throw() {
+
+            }
+
+            // Inherited from HashState
+
+            void SOLAIRE_EXPORT_CALL Initialise() throw() override {
+                mLanes = Lanes(mKey);
+                mTotalBytes = 0;
+                mBufferedBytes = 0;
+            }
+
+            void SOLAIRE_EXPORT_CALL Update(const void* const aValue, const size_t aBytes) throw() override {
+                const uint8_t* data = static_cast<const uint8_t*>(aValue);
+                size_t bytes = aBytes;
+                mTotalBytes += aBytes;
+
+                // Complete a partially filled block
+                if(mBufferedBytes > 0) {
+                    const size_t count = 8 - mBufferedBytes < bytes ? 8 - mBufferedBytes : bytes;
+                    std::memcpy(mBuffer + mBufferedBytes, data, count);
+                    mBufferedBytes += static_cast<uint32_t>(count);
+                    data += count;
+                    bytes -= count;
+                    if(mBufferedBytes < 8) return;
+                    mLanes.Compress(HashUtility::Read64(mBuffer));
+                    mBufferedBytes = 0;
+                }
+
+                const size_t processed = mLanes.CompressBlocks(data, bytes);
+                mBufferedBytes = static_cast<uint32_t>(bytes - processed);
+                std::memcpy(mBuffer, data + processed, mBufferedBytes);
+            }
+
+            HashType SOLAIRE_EXPORT_CALL Finalise() const throw() override {
+                Lanes lanes = mLanes;
+                return lanes.Finalise(mBuffer, mBufferedBytes, mTotalBytes);
+            }
+        };
+    private:
+        SipHashKey mKey;
+    public:
+        /*!
+            \brief Create a SipHash that uses the process key.
+        */
+        SipHash() throw() :
+            mKey(ProcessKey())
+        {}
+
+        SipHash(const SipHashKey& aKey) throw() :
+            mKey(aKey)
+        {}
+
+        // Inherited from HashFunction
+        HashType SOLAIRE_EXPORT_CALL Hash(const void* const aValue, const size_t aBytes) const throw() override{
+            return HashWithKey(aValue, aBytes, mKey);
+        }
+    };
+
+    typedef SipHash<1, 3> SipHash13;
+    typedef SipHash<2, 4> SipHash24;
+}
+
+#endif
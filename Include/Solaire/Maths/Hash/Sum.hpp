@@ -21,57 +21,303 @@
 
 /*!
 \file Sum.hpp
-\brief
+\brief Sums of native endian words, a very fast but weak integrity check.
 \author
 Created			: Adam Smith
 Last modified	: Adam Smith
 \version 1.0
 \date
 Created			: 1st October 2015
-Last Modified	: 1st October 2015
+Last Modified	: 16th October 2026
 */
 
+#include <cstring>
 #include <type_traits>
 #include "HashFunction.hpp"
 
+#if defined(__SSE2__) || defined(_M_X64)
+    #define SOLAIRE_HASH_SUM_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define SOLAIRE_HASH_SUM_SSE2 0
+#endif
+
+#if defined(__AVX2__)
+    #define SOLAIRE_HASH_SUM_AVX2 1
+    #include <immintrin.h>
+#else
+    #define SOLAIRE_HASH_SUM_AVX2 0
+#endif
+
 namespace Solaire{
 
+    namespace HashSumImplementation {
+
+        /*
+            Addition is associative modulo 2^N, so a sum of N bit words can be split across any number of
+            N bit lanes and the lanes added together at the end without changing the result.
+        */
+        template<class WORD>
+        struct Lanes;
+
+        template<>
+        struct Lanes<uint8_t> {
+            #if SOLAIRE_HASH_SUM_SSE2
+                static inline __m128i Add(const __m128i aA, const __m128i aB) throw() { return _mm_add_epi8(aA, aB); }
+            #endif
+            #if SOLAIRE_HASH_SUM_AVX2
+                static inline __m256i Add(const __m256i aA, const __m256i aB) throw() { return _mm256_add_epi8(aA, aB); }
+            #endif
+        };
+
+        template<>
+        struct Lanes<uint16_t> {
+            #if SOLAIRE_HASH_SUM_SSE2
+                static inline __m128i Add(const __m128i aA, const __m128i aB) throw() { return _mm_add_epi16(aA, aB); }
+            #endif
+            #if SOLAIRE_HASH_SUM_AVX2
+                static inline __m256i Add(const __m256i aA, const __m256i aB) throw() { return _mm256_add_epi16(aA, aB); }
+            #endif
+        };
+
+        template<>
+        struct Lanes<uint32_t> {
+            #if SOLAIRE_HASH_SUM_SSE2
+                static inline __m128i Add(const __m128i aA, const __m128i aB) throw() { return _mm_add_epi32(aA, aB); }
+            #endif
+            #if SOLAIRE_HASH_SUM_AVX2
+                static inline __m256i Add(const __m256i aA, const __m256i aB) throw() { return _mm256_add_epi32(aA, aB); }
+            #endif
+        };
+
+        template<>
+        struct Lanes<uint64_t> {
+            #if SOLAIRE_HASH_SUM_SSE2
+                static inline __m128i Add(const __m128i aA, const __m128i aB) throw() { return _mm_add_epi64(aA, aB); }
+            #endif
+            #if SOLAIRE_HASH_SUM_AVX2
+                static inline __m256i Add(const __m256i aA, const __m256i aB) throw() { return _mm256_add_epi64(aA, aB); }
+            #endif
+        };
+
+        template<class WORD, class VECTOR>
+        static inline WORD ReduceLanes(const VECTOR aVector) throw() {
+            WORD words[sizeof(VECTOR) / sizeof(WORD)];
+            std::memcpy(words, &aVector, sizeof(VECTOR));
+            WORD sum = 0;
+            for(const WORD i : words) sum += i;
+            return sum;
+        }
+
+        /*!
+            \brief Add together aWords native endian words of type WORD.
+            \details
+            The data does not need to be aligned. Four independent accumulators are used so that the adds
+            of one iteration do not wait on the previous one, which lets the loop run at load throughput.
+        */
+        template<class WORD>
+        static WORD SumWords(const uint8_t* aData, size_t aWords) throw() {
+            enum : size_t{
+                UNROLL = 4
+            };
+
+            WORD sum = 0;
+
+            #if SOLAIRE_HASH_SUM_AVX2
+            {
+                enum : size_t{
+                    BLOCK_WORDS = sizeof(__m256i) / sizeof(WORD)
+                };
+
+                if(aWords >= BLOCK_WORDS * UNROLL) {
+                    __m256i acc[UNROLL];
+                    for(__m256i& i : acc) i = _mm256_setzero_si256();
+
+                    do {
+                        for(size_t i = 0; i < UNROLL; ++i) {
+                            acc[i] = Lanes<WORD>::Add(acc[i], _mm256_loadu_si256(reinterpret_cast<const __m256i*>(aData) + i));
+                        }
+                        aData += sizeof(__m256i) * UNROLL;
+                        aWords -= BLOCK_WORDS * UNROLL;
+                    }while(aWords >= BLOCK_WORDS * UNROLL);
+
+                    while(aWords >= BLOCK_WORDS) {
+                        acc[0] = Lanes<WORD>::Add(acc[0], _mm256_loadu_si256(reinterpret_cast<const __m256i*>(aData)));
+                        aData += sizeof(__m256i);
+                        aWords -= BLOCK_WORDS;
+                    }
+
+                    acc[0] = Lanes<WORD>::Add(Lanes<WORD>::Add(acc[0], acc[1]), Lanes<WORD>::Add(acc[2], acc[3]));
+                    sum += ReduceLanes<WORD>(acc[0]);
+                }
+            }
+            #endif
+
+            #if SOLAIRE_HASH_SUM_SSE2
+            {
+                enum : size_t{
+                    BLOCK_WORDS = sizeof(__m128i) / sizeof(WORD)
+                };
+
+                if(aWords >= BLOCK_WORDS * UNROLL) {
+                    __m128i acc[UNROLL];
+                    for(__m128i& i : acc) i = _mm_setzero_si128();
+
+                    do {
+                        for(size_t i = 0; i < UNROLL; ++i) {
+                            acc[i] = Lanes<WORD>::Add(acc[i], _mm_loadu_si128(reinterpret_cast<const __m128i*>(aData) + i));
+                        }
+                        aData += sizeof(__m128i) * UNROLL;
+                        aWords -= BLOCK_WORDS * UNROLL;
+                    }while(aWords >= BLOCK_WORDS * UNROLL);
+
+                    acc[0] = Lanes<WORD>::Add(Lanes<WORD>::Add(acc[0], acc[1]), Lanes<WORD>::Add(acc[2], acc[3]));
+                    sum += ReduceLanes<WORD>(acc[0]);
+                }
+            }
+            #endif
+
+            WORD acc[UNROLL] = {};
+            while(aWords >= UNROLL) {
+                for(size_t i = 0; i < UNROLL; ++i) {
+                    WORD tmp;
+                    std::memcpy(&tmp, aData + sizeof(WORD) * i, sizeof(WORD));
+                    acc[i] += tmp;
+                }
+                aData += sizeof(WORD) * UNROLL;
+                aWords -= UNROLL;
+            }
+
+            while(aWords > 0) {
+                WORD tmp;
+                std::memcpy(&tmp, aData, sizeof(WORD));
+                sum += tmp;
+                aData += sizeof(WORD);
+                --aWords;
+            }
+
+            return static_cast<WORD>(sum + acc[0] + acc[1] + acc[2] + acc[3]);
+        }
+    }
+
     template<class T>
     class HashSum : public HashFunction<T>
     {
+    public:
+        class State : public HashState<T> {
+        private:
+            enum : size_t{
+                WORD_SIZE = sizeof(T) < sizeof(uint64_t) ? sizeof(T) : sizeof(uint64_t)
+            };
+        private:
+            T mHash;
+            uint8_t mBuffer[WORD_SIZE];
+            size_t mBufferedBytes;
+        private:
+            typedef typename std::conditional<WORD_SIZE == sizeof(uint64_t), uint64_t,
+                typename std::conditional<WORD_SIZE == sizeof(uint32_t), uint32_t,
+                typename std::conditional<WORD_SIZE == sizeof(uint16_t), uint16_t,
+                uint8_t>::type>::type>::type Word;
+        public:
+            State() throw() :
+                mHash(0),
+                mBufferedBytes(0)
+            {}
+
+            SOLAIRE_EXPORT_CALL ~State() throw() {
+
+            }
+
+            // Inherited from HashState
+
+            void SOLAIRE_EXPORT_CALL Initialise() throw() override {
+                mHash = 0;
+                mBufferedBytes = 0;
+            }
+
+            void SOLAIRE_EXPORT_CALL Update(const void* const aValue, const size_t aBytes) throw() override {
+                const uint8_t* data = static_cast<const uint8_t*>(aValue);
+                size_t bytes = aBytes;
+
+                // Complete a word that was split between calls
+                if(mBufferedBytes > 0) {
+                    const size_t count = WORD_SIZE - mBufferedBytes < bytes ? WORD_SIZE - mBufferedBytes : bytes;
+                    std::memcpy(mBuffer + mBufferedBytes, data, count);
+                    mBufferedBytes += count;
+                    data += count;
+                    bytes -= count;
+                    if(mBufferedBytes < WORD_SIZE) return;
+                    mHash += static_cast<T>(HashSumImplementation::SumWords<Word>(mBuffer, 1));
+                    mBufferedBytes = 0;
+                }
+
+                const size_t words = bytes / WORD_SIZE;
+                if(sizeof(T) <= sizeof(uint64_t)) {
+                    mHash += static_cast<T>(HashSumImplementation::SumWords<Word>(data, words));
+                }else {
+                    // Carries out of the 64 bit words are significant, so the words cannot be summed in 64 bit lanes
+                    T hash = mHash;
+                    for(size_t i = 0; i < words; ++i) {
+                        uint64_t tmp;
+                        std::memcpy(&tmp, data + i * WORD_SIZE, sizeof(uint64_t));
+                        hash += static_cast<T>(tmp);
+                    }
+                    mHash = hash;
+                }
+                data += words * WORD_SIZE;
+                bytes -= words * WORD_SIZE;
+
+                std::memcpy(mBuffer, data, bytes);
+                mBufferedBytes = bytes;
+            }
+
+            T SOLAIRE_EXPORT_CALL Finalise() const throw() override {
+                // Trailing bytes are added in decreasing word sizes
+                T hash = mHash;
+                const uint8_t* data = mBuffer;
+                size_t bytes = mBufferedBytes;
+
+                if(bytes >= sizeof(uint32_t) && sizeof(T) >= sizeof(uint32_t)){
+                    uint32_t tmp;
+                    std::memcpy(&tmp, data, sizeof(uint32_t));
+                    hash += static_cast<T>(tmp);
+                    bytes -= sizeof(uint32_t);
+                    data += sizeof(uint32_t);
+                }
+
+                if(bytes >= sizeof(uint16_t) && sizeof(T) >= sizeof(uint16_t)){
+                    uint16_t tmp;
+                    std::memcpy(&tmp, data, sizeof(uint16_t));
+                    hash += static_cast<T>(tmp);
+                    bytes -= sizeof(uint16_t);
+                    data += sizeof(uint16_t);
+                }
+
+                if(bytes > 0){
+                    hash += *data;
+                }
+
+                return hash;
+            }
+        };
+    public:
+        /*!
+            \brief Static form of HashSum that can be inlined, see HashFunctionAdapter.
+        */
+        struct Policy {
+            typedef T HashType;
+
+            static inline T Hash(const void* const aValue, const size_t aBytes) throw() {
+                State state;
+                state.Update(aValue, aBytes);
+                return state.Finalise();
+            }
+        };
     public:
         // Inherited from HashFunction
         T SOLAIRE_EXPORT_CALL Hash(const void* const aValue, const size_t aBytes) const throw() override{
-            const uint8_t* data = static_cast<const uint8_t*>(data);
-			T hash = 0;
-			size_t bytes = aBytes;
-
-			while(bytes >= sizeof(uint64_t) && sizeof(T) >= sizeof(uint64_t)){
-                hash += *reinterpret_cast<const uint64_t*>(data);
-                bytes -= sizeof(uint64_t);
-                data += sizeof(uint64_t);
-			}
-
-			while(bytes >= sizeof(uint32_t) && sizeof(T) >= sizeof(uint32_t)){
-                hash += *reinterpret_cast<const uint32_t*>(data);
-                bytes -= sizeof(uint32_t);
-                data += sizeof(uint32_t);
-			}
-
-			while(bytes >= sizeof(uint16_t) && sizeof(T) >= sizeof(uint16_t)){
-                hash += *reinterpret_cast<const uint16_t*>(data);
-                bytes -= sizeof(uint16_t);
-                data += sizeof(uint16_t);
-			}
-
-			while(bytes >= 0){
-                hash += *data;
-                --bytes;
-                ++data;
-			}
-
-			return hash;
-        };
+            return Policy::Hash(aValue, aBytes);
+        }
     };
 
     typedef HashSum<uint8_t> HashSum8;
@@ -0,0 +1,134 @@
+#ifndef SOLAIRE_HASH_WYHASH_HPP
+#define SOLAIRE_HASH_WYHASH_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file WyHash.hpp
+	\brief wyhash, a fast 64 bit hash for short keys.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 16th October 2026
+	Last Modified	: 16th October 2026
+*/
+
+#include "HashFunction.hpp"
+#include "HashUtility.hpp"
+
+namespace Solaire{
+
+    /*!
+        \brief wyhash (final version 4), mixes 16 bytes at a time with a 64 x 64 -> 128 bit multiply.
+    */
+    class WyHash : public HashFunction<uint64_t>
+    {
+    private:
+        static inline const uint64_t* Secret() throw() {
+            static const uint64_t SECRET[4] = {
+                0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL
+            };
+            return SECRET;
+        }
+
+        static inline uint64_t Mix(uint64_t aA, uint64_t aB) throw() {
+            return HashUtility::MultiplyFold64(aA, aB);
+        }
+
+        static inline uint64_t Read24(const uint8_t* const aData, const size_t aBytes) throw() {
+            return (static_cast<uint64_t>(aData[0]) << 16) | (static_cast<uint64_t>(aData[aBytes >> 1]) << 8) | aData[aBytes - 1];
+        }
+    public:
+        /*!
+            \brief Calculate the wyhash of data.
+            \param aValue The address of the data.
+            \param aBytes The number of bytes to hash.
+            \param aSeed Selects one of 2^64 different hash functions.
+        */
+        static inline HashType HashWithSeed(const void* const aValue, const size_t aBytes, uint64_t aSeed) throw() {
+            using namespace HashUtility;
+            const uint64_t* const secret = Secret();
+            const uint8_t* data = static_cast<const uint8_t*>(aValue);
+            uint64_t a, b;
+            aSeed ^= Mix(aSeed ^ secret[0], secret[1]);
+
+            if(aBytes <= 16) {
+                // Keys of 4 to 16 bytes are covered by 4 possibly overlapping 4 byte reads
+                if(aBytes >= 4) {
+                    const size_t offset = (aBytes >> 3) << 2;
+                    a = (static_cast<uint64_t>(Read32(data)) << 32) | Read32(data + offset);
+                    b = (static_cast<uint64_t>(Read32(data + aBytes - 4)) << 32) | Read32(data + aBytes - 4 - offset);
+                }else if(aBytes > 0) {
+                    a = Read24(data, aBytes);
+                    b = 0;
+                }else {
+                    a = 0;
+                    b = 0;
+                }
+            }else {
+                size_t bytes = aBytes;
+                if(bytes >= 48) {
+                    uint64_t seed1 = aSeed;
+                    uint64_t seed2 = aSeed;
+                    do{
+                        aSeed = Mix(Read64(data) ^ secret[1], Read64(data + 8) ^ aSeed);
+                        seed1 = Mix(Read64(data + 16) ^ secret[2], Read64(data + 24) ^ seed1);
+                        seed2 = Mix(Read64(data + 32) ^ secret[3], Read64(data + 40) ^ seed2);
+                        data += 48;
+                        bytes -= 48;
+                    }while(bytes >= 48);
+                    aSeed ^= seed1 ^ seed2;
+                }
+                while(bytes > 16) {
+                    aSeed = Mix(Read64(data) ^ secret[1], Read64(data + 8) ^ aSeed);
+                    data += 16;
+                    bytes -= 16;
+                }
+                a = Read64(data + bytes - 16);
+                b = Read64(data + bytes - 8);
+            }
+
+            uint64_t low, high;
+            Multiply128(a ^ secret[1], b ^ aSeed, low, high);
+            return Mix(low ^ secret[0] ^ aBytes, high ^ secret[1]);
+        }
+
+        /*!
+            \brief Static form of WyHash with a seed of 0 that can be inlined, see HashFunctionAdapter.
+        */
+        struct Policy {
+            typedef uint64_t HashType;
+
+            static inline HashType Hash(const void* const aValue, const size_t aBytes) throw() {
+                return WyHash::HashWithSeed(aValue, aBytes, 0);
+            }
+        };
+    private:
+        uint64_t mSeed;
+    public:
+        WyHash(const uint64_t aSeed = 0) throw();
+
+        // Inherited from HashFunction
+        HashType SOLAIRE_EXPORT_CALL Hash(const void* const aValue, const size_t aBytes) const throw() override;
+    };
+}
+
+#endif
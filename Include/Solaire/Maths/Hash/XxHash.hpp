@@ -0,0 +1,704 @@
+#ifndef SOLAIRE_HASH_XXHASH_HPP
+#define SOLAIRE_HASH_XXHASH_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file XxHash.hpp
+	\brief XXH64 and XXH3 64 / 128 bit hashes.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\version 1.0
+	\date
+	Created			: 16th October 2026
+	Last Modified	: 16th October 2026
+*/
+
+#include <cstring>
+#include "HashFunction.hpp"
+#include "HashUtility.hpp"
+
+#if defined(__AVX2__)
+    #define SOLAIRE_XXH3_AVX2 1
+    #define SOLAIRE_XXH3_SSE2 0
+    #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+    #define SOLAIRE_XXH3_AVX2 0
+    #define SOLAIRE_XXH3_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define SOLAIRE_XXH3_AVX2 0
+    #define SOLAIRE_XXH3_SSE2 0
+#endif
+
+namespace Solaire{
+
+    namespace XxHashImplementation {
+        enum : uint64_t{
+            PRIME64_1 = 0x9E3779B185EBCA87ULL,
+            PRIME64_2 = 0xC2B2AE3D27D4EB4FULL,
+            PRIME64_3 = 0x165667B19E3779F9ULL,
+            PRIME64_4 = 0x85EBCA77C2B2AE63ULL,
+            PRIME64_5 = 0x27D4EB2F165667C5ULL,
+            PRIME_MX1 = 0x165667919E3779F9ULL,
+            PRIME_MX2 = 0x9FB21C651E98DF25ULL
+        };
+
+        enum : uint32_t{
+            PRIME32_1 = 0x9E3779B1,
+            PRIME32_2 = 0x85EBCA77,
+            PRIME32_3 = 0xC2B2AE3D
+        };
+
+        using namespace HashUtility;
+    }
+
+    /*!
+        \brief XXH64, processes 32 bytes at a time in 4 independent 64 bit accumulators.
+    */
+    class XxHash64 : public HashFunction<uint64_t>
+    {
+    private:
+        enum : size_t{
+            STRIPE_SIZE = 32
+        };
+
+        static inline uint64_t Round(const uint64_t aAccumulator, const uint64_t aInput) throw() {
+            using namespace XxHashImplementation;
+            return RotateLeft64(aAccumulator + aInput * PRIME64_2, 31) * PRIME64_1;
+        }
+
+        static inline uint64_t MergeRound(const uint64_t aHash, const uint64_t aAccumulator) throw() {
+            using namespace XxHashImplementation;
+            return (aHash ^ Round(0, aAccumulator)) * PRIME64_1 + PRIME64_4;
+        }
+
+        static inline uint64_t MergeAccumulators(const uint64_t* const aAccumulators) throw() {
+            using namespace XxHashImplementation;
+            uint64_t hash =
+                RotateLeft64(aAccumulators[0], 1) + RotateLeft64(aAccumulators[1], 7) +
+                RotateLeft64(aAccumulators[2], 12) + RotateLeft64(aAccumulators[3], 18);
+            hash = MergeRound(hash, aAccumulators[0]);
+            hash = MergeRound(hash, aAccumulators[1]);
+            hash = MergeRound(hash, aAccumulators[2]);
+            return MergeRound(hash, aAccumulators[3]);
+        }
+
+        static inline void InitialiseAccumulators(uint64_t* const aAccumulators, const uint64_t aSeed) throw() {
+            using namespace XxHashImplementation;
+            aAccumulators[0] = aSeed + PRIME64_1 + PRIME64_2;
+            aAccumulators[1] = aSeed + PRIME64_2;
+            aAccumulators[2] = aSeed;
+            aAccumulators[3] = aSeed - PRIME64_1;
+        }
+
+        /*!
+            \brief Add whole stripes to the accumulators.
+            \return The number of bytes that were processed.
+        */
+        static inline size_t UpdateStripes(uint64_t* const aAccumulators, const uint8_t* const aData, const size_t aBytes) throw() {
+            using namespace XxHashImplementation;
+            uint64_t v1 = aAccumulators[0];
+            uint64_t v2 = aAccumulators[1];
+            uint64_t v3 = aAccumulators[2];
+            uint64_t v4 = aAccumulators[3];
+
+            size_t i = 0;
+            for(; i + STRIPE_SIZE <= aBytes; i += STRIPE_SIZE) {
+                v1 = Round(v1, Read64(aData + i));
+                v2 = Round(v2, Read64(aData + i + 8));
+                v3 = Round(v3, Read64(aData + i + 16));
+                v4 = Round(v4, Read64(aData + i + 24));
+            }
+
+            aAccumulators[0] = v1;
+            aAccumulators[1] = v2;
+            aAccumulators[2] = v3;
+            aAccumulators[3] = v4;
+            return i;
+        }
+
+        /*!
+            \brief Add the last 0 to 31 bytes and avalanche.
+        */
+        static inline uint64_t Finish(uint64_t aHash, const uint8_t* aData, size_t aBytes) throw() {
+            using namespace XxHashImplementation;
+            for(; aBytes >= 8; aBytes -= 8, aData += 8) {
+                aHash ^= Round(0, Read64(aData));
+                aHash = RotateLeft64(aHash, 27) * PRIME64_1 + PRIME64_4;
+            }
+            if(aBytes >= 4) {
+                aHash ^= static_cast<uint64_t>(Read32(aData)) * PRIME64_1;
+                aHash = RotateLeft64(aHash, 23) * PRIME64_2 + PRIME64_3;
+                aBytes -= 4;
+                aData += 4;
+            }
+            for(; aBytes > 0; --aBytes, ++aData) {
+                aHash ^= *aData * PRIME64_5;
+                aHash = RotateLeft64(aHash, 11) * PRIME64_1;
+            }
+
+            aHash ^= aHash >> 33;
+            aHash *= PRIME64_2;
+            aHash ^= aHash >> 29;
+            aHash *= PRIME64_3;
+            aHash ^= aHash >> 32;
+            return aHash;
+        }
+    public:
+        /*!
+            \brief Calculate the XXH64 hash of data.
+            \param aValue The address of the data.
+            \param aBytes The number of bytes to hash.
+            \param aSeed Selects one of 2^64 different hash functions.
+        */
+        static inline HashType HashWithSeed(const void* const aValue, const size_t aBytes, const uint64_t aSeed) throw() {
+            using namespace XxHashImplementation;
+            const uint8_t* const data = static_cast<const uint8_t*>(aValue);
+            uint64_t hash;
+            size_t offset = 0;
+
+            if(aBytes >= STRIPE_SIZE) {
+                uint64_t accumulators[4];
+                InitialiseAccumulators(accumulators, aSeed);
+                offset = UpdateStripes(accumulators, data, aBytes);
+                hash = MergeAccumulators(accumulators);
+            }else {
+                hash = aSeed + PRIME64_5;
+            }
+
+            return Finish(hash + aBytes, data + offset, aBytes - offset);
+        }
+
+        /*!
+            \brief Static form of XxHash64 with a seed of 0 that can be inlined, see HashFunctionAdapter.
+        */
+        struct Policy {
+            typedef uint64_t HashType;
+
+            static inline HashType Hash(const void* const aValue, const size_t aBytes) throw() {
+                return XxHash64::HashWithSeed(aValue, aBytes, 0);
+            }
+        };
+
+        class State : public HashState<uint64_t> {
+        private:
+            uint64_t mAccumulators[4];
+            uint64_t mTotalBytes;
+            uint64_t mSeed;
+            uint8_t mBuffer[STRIPE_SIZE];
+            uint32_t mBufferedBytes;
+        public:
+            State(const uint64_t aSeed = 0) throw();
+            SOLAIRE_EXPORT_CALL ~State() throw();
+
+            // Inherited from HashState
+            void SOLAIRE_EXPORT_CALL Initialise() throw() override;
+            void SOLAIRE_EXPORT_CALL Update(const void* const aValue, const size_t aBytes) throw() override;
+            HashType SOLAIRE_EXPORT_CALL Finalise() const throw() override;
+        };
+    private:
+        uint64_t mSeed;
+    public:
+        XxHash64(const uint64_t aSeed = 0) throw();
+
+        // Inherited from HashFunction
+        HashType SOLAIRE_EXPORT_CALL Hash(const void* const aValue, const size_t aBytes) const throw() override;
+    };
+
+    /*!
+        \brief XXH3 64 and 128 bit hashes.
+        \details
+        Inputs of up to 240 bytes are mixed directly with the secret, longer inputs are accumulated
+        64 bytes at a time in 8 64 bit lanes. The lanes are processed with SSE2 or AVX2 when available.
+    */
+    class Xxh3 : public HashFunction<uint64_t>
+    {
+    private:
+        enum : size_t{
+            STRIPE_SIZE             = 64,   //!< The number of bytes added to the accumulators at a time.
+            ACCUMULATORS            = 8,    //!< The number of 64 bit accumulator lanes.
+            SECRET_SIZE             = 192,  //!< The size of the default secret.
+            SECRET_SIZE_MIN         = 136,  //!< The size of secret used by inputs up to MID_SIZE_MAX bytes.
+            SECRET_CONSUME_RATE     = 8,    //!< The secret advances this many bytes per stripe.
+            SECRET_MERGE_START      = 11,   //!< The offset of the secret used to merge the accumulators.
+            SECRET_LAST_START       = 7,    //!< The offset from the end of the secret used for the last stripe.
+            STRIPES_PER_BLOCK       = (SECRET_SIZE - STRIPE_SIZE) / SECRET_CONSUME_RATE,
+            BLOCK_SIZE              = STRIPES_PER_BLOCK * STRIPE_SIZE,
+            MID_SIZE_MAX            = 240,  //!< The largest input that is not accumulated in stripes.
+            BUFFER_SIZE             = 256   //!< The number of bytes buffered by State.
+        };
+
+        static inline const uint8_t* DefaultSecret() throw() {
+            static const uint8_t SECRET[SECRET_SIZE] = {
+                0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+                0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+                0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+                0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+                0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+                0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+                0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+                0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+                0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+                0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+                0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+                0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e
+            };
+            return SECRET;
+        }
+
+        /*!
+            \brief Derive the secret used by long inputs from a seed.
+        */
+        static inline void SeedSecret(uint8_t* const aSecret, const uint64_t aSeed) throw() {
+            using namespace XxHashImplementation;
+            const uint8_t* const secret = DefaultSecret();
+            for(size_t i = 0; i < SECRET_SIZE; i += 16) {
+                const uint64_t low = Read64(secret + i) + aSeed;
+                const uint64_t high = Read64(secret + i + 8) - aSeed;
+                std::memcpy(aSecret + i, &low, sizeof(uint64_t));
+                std::memcpy(aSecret + i + 8, &high, sizeof(uint64_t));
+            }
+        }
+
+        static inline void InitialiseAccumulators(uint64_t* const aAccumulators) throw() {
+            using namespace XxHashImplementation;
+            aAccumulators[0] = PRIME32_3;
+            aAccumulators[1] = PRIME64_1;
+            aAccumulators[2] = PRIME64_2;
+            aAccumulators[3] = PRIME64_3;
+            aAccumulators[4] = PRIME64_4;
+            aAccumulators[5] = PRIME32_2;
+            aAccumulators[6] = PRIME64_5;
+            aAccumulators[7] = PRIME32_1;
+        }
+
+        static inline uint64_t Avalanche(uint64_t aHash) throw() {
+            using namespace XxHashImplementation;
+            aHash ^= aHash >> 37;
+            aHash *= PRIME_MX1;
+            return aHash ^ (aHash >> 32);
+        }
+
+        static inline uint64_t Avalanche64(uint64_t aHash) throw() {
+            using namespace XxHashImplementation;
+            aHash ^= aHash >> 33;
+            aHash *= PRIME64_2;
+            aHash ^= aHash >> 29;
+            aHash *= PRIME64_3;
+            return aHash ^ (aHash >> 32);
+        }
+
+        static inline uint64_t StrongAvalanche(uint64_t aHash, const uint64_t aBytes) throw() {
+            using namespace XxHashImplementation;
+            aHash ^= RotateLeft64(aHash, 49) ^ RotateLeft64(aHash, 24);
+            aHash *= PRIME_MX2;
+            aHash ^= (aHash >> 35) + aBytes;
+            aHash *= PRIME_MX2;
+            return aHash ^ (aHash >> 28);
+        }
+
+        static inline uint64_t Mix16(const uint8_t* const aData, const uint8_t* const aSecret, const uint64_t aSeed) throw() {
+            using namespace XxHashImplementation;
+            return MultiplyFold64(
+                Read64(aData) ^ (Read64(aSecret) + aSeed),
+                Read64(aData + 8) ^ (Read64(aSecret + 8) - aSeed)
+            );
+        }
+
+        static inline void Mix32(uint64_t& aLow, uint64_t& aHigh, const uint8_t* const aData1, const uint8_t* const aData2, const uint8_t* const aSecret, const uint64_t aSeed) throw() {
+            using namespace XxHashImplementation;
+            aLow += Mix16(aData1, aSecret, aSeed);
+            aLow ^= Read64(aData2) + Read64(aData2 + 8);
+            aHigh += Mix16(aData2, aSecret + 16, aSeed);
+            aHigh ^= Read64(aData1) + Read64(aData1 + 8);
+        }
+
+        /*!
+            \brief Add one stripe to the accumulators.
+        */
+        static inline void Accumulate(uint64_t* const aAccumulators, const uint8_t* const aData, const uint8_t* const aSecret) throw() {
+#if SOLAIRE_XXH3_AVX2
+            __m256i* const accumulators = reinterpret_cast<__m256i*>(aAccumulators);
+            for(size_t i = 0; i < 2; ++i) {
+                const __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(aData) + i);
+                const __m256i key = _mm256_xor_si256(data, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(aSecret) + i));
+                const __m256i product = _mm256_mul_epu32(key, _mm256_srli_epi64(key, 32));
+                const __m256i swapped = _mm256_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+                _mm256_storeu_si256(accumulators + i, _mm256_add_epi64(_mm256_loadu_si256(accumulators + i), _mm256_add_epi64(product, swapped)));
+            }
+#elif SOLAIRE_XXH3_SSE2
+            __m128i* const accumulators = reinterpret_cast<__m128i*>(aAccumulators);
+            for(size_t i = 0; i < 4; ++i) {
+                const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(aData) + i);
+                const __m128i key = _mm_xor_si128(data, _mm_loadu_si128(reinterpret_cast<const __m128i*>(aSecret) + i));
+                const __m128i product = _mm_mul_epu32(key, _mm_shuffle_epi32(key, _MM_SHUFFLE(0, 3, 0, 1)));
+                const __m128i swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+                _mm_storeu_si128(accumulators + i, _mm_add_epi64(_mm_loadu_si128(accumulators + i), _mm_add_epi64(product, swapped)));
+            }
+#else
+            using namespace XxHashImplementation;
+            for(size_t i = 0; i < ACCUMULATORS; ++i) {
+                const uint64_t data = Read64(aData + i * 8);
+                const uint64_t key = data ^ Read64(aSecret + i * 8);
+                aAccumulators[i ^ 1] += data;
+                aAccumulators[i] += (key & 0xFFFFFFFF) * (key >> 32);
+            }
+#endif
+        }
+
+        /*!
+            \brief Mix the accumulators at the end of each block so that long inputs do not cancel out.
+        */
+        static inline void Scramble(uint64_t* const aAccumulators, const uint8_t* const aSecret) throw() {
+            using namespace XxHashImplementation;
+#if SOLAIRE_XXH3_AVX2
+            __m256i* const accumulators = reinterpret_cast<__m256i*>(aAccumulators);
+            const __m256i prime = _mm256_set1_epi32(static_cast<int>(PRIME32_1));
+            for(size_t i = 0; i < 2; ++i) {
+                __m256i accumulator = _mm256_loadu_si256(accumulators + i);
+                accumulator = _mm256_xor_si256(accumulator, _mm256_srli_epi64(accumulator, 47));
+                accumulator = _mm256_xor_si256(accumulator, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(aSecret) + i));
+                const __m256i low = _mm256_mul_epu32(accumulator, prime);
+                const __m256i high = _mm256_mul_epu32(_mm256_srli_epi64(accumulator, 32), prime);
+                _mm256_storeu_si256(accumulators + i, _mm256_add_epi64(low, _mm256_slli_epi64(high, 32)));
+            }
+#elif SOLAIRE_XXH3_SSE2
+            __m128i* const accumulators = reinterpret_cast<__m128i*>(aAccumulators);
+            const __m128i prime = _mm_set1_epi32(static_cast<int>(PRIME32_1));
+            for(size_t i = 0; i < 4; ++i) {
+                __m128i accumulator = _mm_loadu_si128(accumulators + i);
+                accumulator = _mm_xor_si128(accumulator, _mm_srli_epi64(accumulator, 47));
+                accumulator = _mm_xor_si128(accumulator, _mm_loadu_si128(reinterpret_cast<const __m128i*>(aSecret) + i));
+                const __m128i low = _mm_mul_epu32(accumulator, prime);
+                const __m128i high = _mm_mul_epu32(_mm_shuffle_epi32(accumulator, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+                _mm_storeu_si128(accumulators + i, _mm_add_epi64(low, _mm_slli_epi64(high, 32)));
+            }
+#else
+            for(size_t i = 0; i < ACCUMULATORS; ++i) {
+                uint64_t accumulator = aAccumulators[i];
+                accumulator ^= accumulator >> 47;
+                accumulator ^= Read64(aSecret + i * 8);
+                aAccumulators[i] = accumulator * PRIME32_1;
+            }
+#endif
+        }
+
+        static inline void AccumulateStripes(uint64_t* const aAccumulators, const uint8_t* const aData, const uint8_t* const aSecret, const size_t aStripes) throw() {
+            for(size_t i = 0; i < aStripes; ++i) {
+                Accumulate(aAccumulators, aData + i * STRIPE_SIZE, aSecret + i * SECRET_CONSUME_RATE);
+            }
+        }
+
+        /*!
+            \brief Accumulate stripes that may cross the end of a block.
+            \param aStripes The number of stripes that have already been accumulated in the current block.
+            \return The number of stripes in the current block after the data has been added.
+        */
+        static inline uint32_t AccumulateBlocks(uint64_t* const aAccumulators, const uint8_t* const aData, const size_t aCount, const uint32_t aStripes, const uint8_t* const aSecret) throw() {
+            if(STRIPES_PER_BLOCK - aStripes <= aCount) {
+                const size_t toEnd = STRIPES_PER_BLOCK - aStripes;
+                AccumulateStripes(aAccumulators, aData, aSecret + aStripes * SECRET_CONSUME_RATE, toEnd);
+                Scramble(aAccumulators, aSecret + SECRET_SIZE - STRIPE_SIZE);
+                AccumulateStripes(aAccumulators, aData + toEnd * STRIPE_SIZE, aSecret, aCount - toEnd);
+                return static_cast<uint32_t>(aCount - toEnd);
+            }else {
+                AccumulateStripes(aAccumulators, aData, aSecret + aStripes * SECRET_CONSUME_RATE, aCount);
+                return static_cast<uint32_t>(aStripes + aCount);
+            }
+        }
+
+        /*!
+            \brief Accumulate an input of more than MID_SIZE_MAX bytes.
+        */
+        static inline void AccumulateLong(uint64_t* const aAccumulators, const uint8_t* const aData, const size_t aBytes, const uint8_t* const aSecret) throw() {
+            const size_t blocks = (aBytes - 1) / BLOCK_SIZE;
+            for(size_t i = 0; i < blocks; ++i) {
+                AccumulateStripes(aAccumulators, aData + i * BLOCK_SIZE, aSecret, STRIPES_PER_BLOCK);
+                Scramble(aAccumulators, aSecret + SECRET_SIZE - STRIPE_SIZE);
+            }
+
+            const size_t stripes = ((aBytes - 1) - blocks * BLOCK_SIZE) / STRIPE_SIZE;
+            AccumulateStripes(aAccumulators, aData + blocks * BLOCK_SIZE, aSecret, stripes);
+            Accumulate(aAccumulators, aData + aBytes - STRIPE_SIZE, aSecret + SECRET_SIZE - STRIPE_SIZE - SECRET_LAST_START);
+        }
+
+        static inline uint64_t MergeAccumulators(const uint64_t* const aAccumulators, const uint8_t* const aSecret, uint64_t aHash) throw() {
+            using namespace XxHashImplementation;
+            for(size_t i = 0; i < ACCUMULATORS; i += 2) {
+                aHash += MultiplyFold64(aAccumulators[i] ^ Read64(aSecret + i * 8), aAccumulators[i + 1] ^ Read64(aSecret + i * 8 + 8));
+            }
+            return Avalanche(aHash);
+        }
+
+        static inline uint64_t Finish64(const uint64_t* const aAccumulators, const uint8_t* const aSecret, const uint64_t aBytes) throw() {
+            using namespace XxHashImplementation;
+            return MergeAccumulators(aAccumulators, aSecret + SECRET_MERGE_START, aBytes * PRIME64_1);
+        }
+
+        static inline Hash128 Finish128(const uint64_t* const aAccumulators, const uint8_t* const aSecret, const uint64_t aBytes) throw() {
+            using namespace XxHashImplementation;
+            Hash128 hash;
+            hash.Low = MergeAccumulators(aAccumulators, aSecret + SECRET_MERGE_START, aBytes * PRIME64_1);
+            hash.High = MergeAccumulators(aAccumulators, aSecret + SECRET_SIZE - STRIPE_SIZE - SECRET_MERGE_START, ~(aBytes * PRIME64_2));
+            return hash;
+        }
+
+        // 64 bit
+
+        static inline uint64_t Hash64Short(const uint8_t* const aData, const size_t aBytes, const uint8_t* const aSecret, uint64_t aSeed) throw() {
+            using namespace XxHashImplementation;
+            if(aBytes > 8) {
+                const uint64_t low = Read64(aData) ^ ((Read64(aSecret + 24) ^ Read64(aSecret + 32)) + aSeed);
+                const uint64_t high = Read64(aData + aBytes - 8) ^ ((Read64(aSecret + 40) ^ Read64(aSecret + 48)) - aSeed);
+                return Avalanche(aBytes + ByteSwap64(low) + high + MultiplyFold64(low, high));
+            }else if(aBytes >= 4) {
+                aSeed ^= static_cast<uint64_t>(ByteSwap32(static_cast<uint32_t>(aSeed))) << 32;
+                const uint64_t input = Read32(aData + aBytes - 4) + (static_cast<uint64_t>(Read32(aData)) << 32);
+                return StrongAvalanche(input ^ ((Read64(aSecret + 8) ^ Read64(aSecret + 16)) - aSeed), aBytes);
+            }else if(aBytes > 0) {
+                const uint32_t combined =
+                    (static_cast<uint32_t>(aData[0]) << 16) | (static_cast<uint32_t>(aData[aBytes >> 1]) << 24) |
+                    static_cast<uint32_t>(aData[aBytes - 1]) | (static_cast<uint32_t>(aBytes) << 8);
+                return Avalanche64(combined ^ ((Read32(aSecret) ^ Read32(aSecret + 4)) + aSeed));
+            }else {
+                return Avalanche64(aSeed ^ Read64(aSecret + 56) ^ Read64(aSecret + 64));
+            }
+        }
+
+        static inline uint64_t Hash64Medium(const uint8_t* const aData, const size_t aBytes, const uint8_t* const aSecret, const uint64_t aSeed) throw() {
+            using namespace XxHashImplementation;
+            uint64_t hash = aBytes * PRIME64_1;
+            if(aBytes > 32) {
+                if(aBytes > 64) {
+                    if(aBytes > 96) {
+                        hash += Mix16(aData + 48, aSecret + 96, aSeed);
+                        hash += Mix16(aData + aBytes - 64, aSecret + 112, aSeed);
+                    }
+                    hash += Mix16(aData + 32, aSecret + 64, aSeed);
+                    hash += Mix16(aData + aBytes - 48, aSecret + 80, aSeed);
+                }
+                hash += Mix16(aData + 16, aSecret + 32, aSeed);
+                hash += Mix16(aData + aBytes - 32, aSecret + 48, aSeed);
+            }
+            hash += Mix16(aData, aSecret, aSeed);
+            hash += Mix16(aData + aBytes - 16, aSecret + 16, aSeed);
+            return Avalanche(hash);
+        }
+
+        static inline uint64_t Hash64Large(const uint8_t* const aData, const size_t aBytes, const uint8_t* const aSecret, const uint64_t aSeed) throw() {
+            using namespace XxHashImplementation;
+            uint64_t hash = aBytes * PRIME64_1;
+            const size_t rounds = aBytes / 16;
+            for(size_t i = 0; i < 8; ++i) hash += Mix16(aData + i * 16, aSecret + i * 16, aSeed);
+            hash = Avalanche(hash);
+            for(size_t i = 8; i < rounds; ++i) hash += Mix16(aData + i * 16, aSecret + (i - 8) * 16 + 3, aSeed);
+            hash += Mix16(aData + aBytes - 16, aSecret + SECRET_SIZE_MIN - 17, aSeed);
+            return Avalanche(hash);
+        }
+
+        // 128 bit
+
+        static inline Hash128 Hash128Short(const uint8_t* const aData, const size_t aBytes, const uint8_t* const aSecret, uint64_t aSeed) throw() {
+            using namespace XxHashImplementation;
+            Hash128 hash;
+            if(aBytes > 8) {
+                const uint64_t low = Read64(aData);
+                uint64_t high = Read64(aData + aBytes - 8);
+                uint64_t productLow, productHigh;
+                Multiply128(low ^ high ^ ((Read64(aSecret + 32) ^ Read64(aSecret + 40)) - aSeed), PRIME64_1, productLow, productHigh);
+                productLow += static_cast<uint64_t>(aBytes - 1) << 54;
+                high ^= (Read64(aSecret + 48) ^ Read64(aSecret + 56)) + aSeed;
+                productHigh += high + (high & 0xFFFFFFFF) * (PRIME32_2 - 1);
+                productLow ^= ByteSwap64(productHigh);
+
+                uint64_t resultLow, resultHigh;
+                Multiply128(productLow, PRIME64_2, resultLow, resultHigh);
+                resultHigh += productHigh * PRIME64_2;
+                hash.Low = Avalanche(resultLow);
+                hash.High = Avalanche(resultHigh);
+            }else if(aBytes >= 4) {
+                aSeed ^= static_cast<uint64_t>(ByteSwap32(static_cast<uint32_t>(aSeed))) << 32;
+                const uint64_t input = Read32(aData) + (static_cast<uint64_t>(Read32(aData + aBytes - 4)) << 32);
+                uint64_t low, high;
+                Multiply128(input ^ ((Read64(aSecret + 16) ^ Read64(aSecret + 24)) + aSeed), PRIME64_1 + (static_cast<uint64_t>(aBytes) << 2), low, high);
+                high += low << 1;
+                low ^= high >> 3;
+                low ^= low >> 35;
+                low *= PRIME_MX2;
+                hash.Low = low ^ (low >> 28);
+                hash.High = Avalanche(high);
+            }else if(aBytes > 0) {
+                const uint32_t combined =
+                    (static_cast<uint32_t>(aData[0]) << 16) | (static_cast<uint32_t>(aData[aBytes >> 1]) << 24) |
+                    static_cast<uint32_t>(aData[aBytes - 1]) | (static_cast<uint32_t>(aBytes) << 8);
+                const uint32_t combinedHigh = RotateLeft32(ByteSwap32(combined), 13);
+                hash.Low = Avalanche64(combined ^ ((static_cast<uint64_t>(Read32(aSecret) ^ Read32(aSecret + 4))) + aSeed));
+                hash.High = Avalanche64(combinedHigh ^ ((static_cast<uint64_t>(Read32(aSecret + 8) ^ Read32(aSecret + 12))) - aSeed));
+            }else {
+                hash.Low = Avalanche64(aSeed ^ Read64(aSecret + 64) ^ Read64(aSecret + 72));
+                hash.High = Avalanche64(aSeed ^ Read64(aSecret + 80) ^ Read64(aSecret + 88));
+            }
+            return hash;
+        }
+
+        static inline Hash128 Finish128Mixed(const uint64_t aLow, const uint64_t aHigh, const size_t aBytes, const uint64_t aSeed) throw() {
+            using namespace XxHashImplementation;
+            Hash128 hash;
+            hash.Low = Avalanche(aLow + aHigh);
+            hash.High = 0 - Avalanche(aLow * PRIME64_1 + aHigh * PRIME64_4 + (aBytes - aSeed) * PRIME64_2);
+            return hash;
+        }
+
+        static inline Hash128 Hash128Medium(const uint8_t* const aData, const size_t aBytes, const uint8_t* const aSecret, const uint64_t aSeed) throw() {
+            using namespace XxHashImplementation;
+            uint64_t low = aBytes * PRIME64_1;
+            uint64_t high = 0;
+            if(aBytes > 32) {
+                if(aBytes > 64) {
+                    if(aBytes > 96) {
+                        Mix32(low, high, aData + 48, aData + aBytes - 64, aSecret + 96, aSeed);
+                    }
+                    Mix32(low, high, aData + 32, aData + aBytes - 48, aSecret + 64, aSeed);
+                }
+                Mix32(low, high, aData + 16, aData + aBytes - 32, aSecret + 32, aSeed);
+            }
+            Mix32(low, high, aData, aData + aBytes - 16, aSecret, aSeed);
+            return Finish128Mixed(low, high, aBytes, aSeed);
+        }
+
+        static inline Hash128 Hash128Large(const uint8_t* const aData, const size_t aBytes, const uint8_t* const aSecret, const uint64_t aSeed) throw() {
+            using namespace XxHashImplementation;
+            uint64_t low = aBytes * PRIME64_1;
+            uint64_t high = 0;
+            const size_t rounds = aBytes / 32;
+            for(size_t i = 0; i < 4; ++i) Mix32(low, high, aData + i * 32, aData + i * 32 + 16, aSecret + i * 32, aSeed);
+            low = Avalanche(low);
+            high = Avalanche(high);
+            for(size_t i = 4; i < rounds; ++i) Mix32(low, high, aData + i * 32, aData + i * 32 + 16, aSecret + (i - 4) * 32 + 3, aSeed);
+            Mix32(low, high, aData + aBytes - 16, aData + aBytes - 32, aSecret + SECRET_SIZE_MIN - 17 - 16, 0 - aSeed);
+            return Finish128Mixed(low, high, aBytes, aSeed);
+        }
+    public:
+        /*!
+            \brief Calculate the 64 bit XXH3 hash of data.
+            \param aValue The address of the data.
+            \param aBytes The number of bytes to hash.
+            \param aSeed Selects one of 2^64 different hash functions.
+        */
+        static inline HashType HashWithSeed(const void* const aValue, const size_t aBytes, const uint64_t aSeed) throw() {
+            const uint8_t* const data = static_cast<const uint8_t*>(aValue);
+            if(aBytes <= 16) return Hash64Short(data, aBytes, DefaultSecret(), aSeed);
+            if(aBytes <= 128) return Hash64Medium(data, aBytes, DefaultSecret(), aSeed);
+            if(aBytes <= MID_SIZE_MAX) return Hash64Large(data, aBytes, DefaultSecret(), aSeed);
+
+            uint64_t accumulators[ACCUMULATORS];
+            InitialiseAccumulators(accumulators);
+            if(aSeed == 0) {
+                AccumulateLong(accumulators, data, aBytes, DefaultSecret());
+                return Finish64(accumulators, DefaultSecret(), aBytes);
+            }else {
+                uint8_t secret[SECRET_SIZE];
+                SeedSecret(secret, aSeed);
+                AccumulateLong(accumulators, data, aBytes, secret);
+                return Finish64(accumulators, secret, aBytes);
+            }
+        }
+
+        /*!
+            \brief Calculate the 128 bit XXH3 hash of data.
+            \param aValue The address of the data.
+            \param aBytes The number of bytes to hash.
+            \param aSeed Selects one of 2^64 different hash functions.
+        */
+        static inline Hash128 Hash128WithSeed(const void* const aValue, const size_t aBytes, const uint64_t aSeed) throw() {
+            const uint8_t* const data = static_cast<const uint8_t*>(aValue);
+            if(aBytes <= 16) return Hash128Short(data, aBytes, DefaultSecret(), aSeed);
+            if(aBytes <= 128) return Hash128Medium(data, aBytes, DefaultSecret(), aSeed);
+            if(aBytes <= MID_SIZE_MAX) return Hash128Large(data, aBytes, DefaultSecret(), aSeed);
+
+            uint64_t accumulators[ACCUMULATORS];
+            InitialiseAccumulators(accumulators);
+            if(aSeed == 0) {
+                AccumulateLong(accumulators, data, aBytes, DefaultSecret());
+                return Finish128(accumulators, DefaultSecret(), aBytes);
+            }else {
+                uint8_t secret[SECRET_SIZE];
+                SeedSecret(secret, aSeed);
+                AccumulateLong(accumulators, data, aBytes, secret);
+                return Finish128(accumulators, secret, aBytes);
+            }
+        }
+
+        /*!
+            \brief Static form of the 64 bit Xxh3 with a seed of 0 that can be inlined, see HashFunctionAdapter.
+        */
+        struct Policy {
+            typedef uint64_t HashType;
+
+            static inline HashType Hash(const void* const aValue, const size_t aBytes) throw() {
+                return Xxh3::HashWithSeed(aValue, aBytes, 0);
+            }
+        };
+
+        /*!
+            \brief Incremental XXH3, both the 64 and 128 bit hash can be read from the same state.
+        */
+        class State : public HashState<uint64_t> {
+        private:
+            uint64_t mAccumulators[ACCUMULATORS];
+            uint8_t mSecret[SECRET_SIZE];
+            uint8_t mBuffer[BUFFER_SIZE];
+            uint64_t mTotalBytes;
+            uint64_t mSeed;
+            uint32_t mBufferedBytes;
+            uint32_t mStripes;          //!< The number of stripes accumulated in the current block.
+        private:
+            void AccumulateBuffer(uint64_t* const aAccumulators) const throw();
+        public:
+            State(const uint64_t aSeed = 0) throw();
+            SOLAIRE_EXPORT_CALL ~State() throw();
+
+            /*!
+                \brief Calculate the 128 bit hash of all data added since the last call to Initialise.
+            */
+            Hash128 Finalise128() const throw();
+
+            // Inherited from HashState
+            void SOLAIRE_EXPORT_CALL Initialise() throw() override;
+            void SOLAIRE_EXPORT_CALL Update(const void* const aValue, const size_t aBytes) throw() override;
+            HashType SOLAIRE_EXPORT_CALL Finalise() const throw() override;
+        };
+    private:
+        uint64_t mSeed;
+    public:
+        Xxh3(const uint64_t aSeed = 0) throw();
+
+        /*!
+            \brief Calculate the 128 bit XXH3 hash of data with this function's seed.
+        */
+        Hash128 Hash128Of(const void* const aValue, const size_t aBytes) const throw();
+
+        // Inherited from HashFunction
+        HashType SOLAIRE_EXPORT_CALL Hash(const void* const aValue, const size_t aBytes) const throw() override;
+    };
+}
+
+#endif
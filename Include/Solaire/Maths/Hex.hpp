@@ -27,13 +27,14 @@
 	Last modified	: Adam Smith
 	\date
 	Created			: 9th January 2016
-	Last Modified	: 9th January 2016
+	Last Modified	: 16th October 2026
 */
 
 #include <cstdint>
 #include "Solaire/Core/Maths.hpp"
 #include "Solaire/Core/IStream.hpp"
 #include "Solaire/Core/OStream.hpp"
+#include "CpuDispatch.hpp"
 
 namespace Solaire {
 
@@ -78,7 +79,7 @@ namespace Solaire {
         \return The binary value of the character.
     */
     static constexpr uint8_t hexToBin4(const HexChar aHex) {
-        return HexImplementation::HEX2BIN_LOOKUP[aHex];
+        return HexImplementation::HEX2BIN_LOOKUP[static_cast<uint8_t>(aHex)];
     }
 
     /*!
@@ -108,7 +109,7 @@ namespace Solaire {
     */
     static constexpr uint32_t hexToBin32(const HexChar* const aHex) {
         return
-            static_cast<uint32_t>(hexToBin16(aHex) << 16) |
+            (static_cast<uint32_t>(hexToBin16(aHex)) << 16) |
             static_cast<uint32_t>(hexToBin16(aHex + 4));
     }
 
@@ -119,7 +120,7 @@ namespace Solaire {
     */
     static constexpr uint64_t hexToBin64(const HexChar* const aHex) {
         return
-            static_cast<uint64_t>(hexToBin32(aHex) << 32L) |
+            (static_cast<uint64_t>(hexToBin32(aHex)) << 32L) |
             static_cast<uint64_t>(hexToBin32(aHex + 8));
     }
 
@@ -175,7 +176,7 @@ namespace Solaire {
         \param aByte The binary data.
         \param aChars The address to write the hex characters into.
     */
-    static void bin64ToHex(const uint32_t aByte, HexChar* const aChars) {
+    static void bin64ToHex(const uint64_t aByte, HexChar* const aChars) {
         aChars[0] = bin4ToHex((aByte >> 60L) & NYBBLE_0);
         aChars[1] = bin4ToHex((aByte >> 56L) & NYBBLE_0);
         aChars[2] = bin4ToHex((aByte >> 52L) & NYBBLE_0);
@@ -222,37 +223,7 @@ namespace Solaire {
     */
     static bool binaryToHex(const void* const aBinary, const uint32_t aBinaryLength, HexChar* const aHex, const uint32_t aHexLength) {
         if(aHexLength < binaryToHexLength(aBinaryLength)) return false;
-        const uint8_t* const bin = static_cast<const uint8_t*>(aBinary);
-        HexChar* hex = aHex;
-        int32_t bytes = aBinaryLength - 1;
-
-        while(bytes >= 7) {
-            bytes -= 7;
-            bin64ToHex(*reinterpret_cast<const uint64_t*>(bin + bytes), hex);
-            --bytes;
-            hex += 16;
-        }
-
-        if(bytes >= 3) {
-            bytes -= 3;
-            bin32ToHex(*reinterpret_cast<const uint32_t*>(bin + bytes), hex);
-            --bytes;
-            hex += 8;
-        }
-
-        if(bytes >= 1) {
-            --bytes;
-            bin16ToHex(*reinterpret_cast<const uint16_t*>(bin + bytes), hex);
-            --bytes;
-            hex += 4;
-        }
-
-        if(bytes >= 0) {
-            bin8ToHex(bin[bytes], hex);
-            --bytes;
-            hex += 2;
-        }
-
+        getMathsKernels().binaryToHex(aBinary, aBinaryLength, aHex);
         return true;
     }
 
@@ -265,43 +236,8 @@ namespace Solaire {
         \return False if aBinaryLength is too small to store the binary representation.
     */
     static bool hexToBinary(const HexChar* const aHex, const uint32_t aHexLength, void* const aBinary, const uint32_t aBinaryLength) {
-        if(aHexLength < hexToBinaryLength(aHexLength)) return false;
-        const HexChar* hex = aHex;
-        const HexChar* end = hex + aHexLength;
-        uint8_t* bin = static_cast<uint8_t*>(aBinary) + (aBinaryLength - 1);
-
-        // Convert all paired characters
-        while((end - hex) >= 16) {
-            bin -= 7;
-            *reinterpret_cast<uint64_t*>(bin) = hexToBin64(hex);
-            hex += 16;
-            --bin;
-        }
-
-        if((end - hex) >= 8) {
-            bin -= 3;
-            *reinterpret_cast<uint32_t*>(bin) = hexToBin32(hex);
-            hex += 8;
-            --bin;
-        }
-
-        if((end - hex) >= 4) {
-            --bin;
-            *reinterpret_cast<uint16_t*>(bin) = hexToBin16(hex);
-            hex += 4;
-            --bin;
-        }
-
-        if((end - hex) >= 2) {
-            *bin = hexToBin8(hex);
-            hex += 2;
-            --bin;
-        }
-
-        // Convert trailing character, if present
-        if((end - hex) == 1) {
-            *bin = hexToBin4(*hex) << 4;
-        }
+        if(aBinaryLength < hexToBinaryLength(aHexLength)) return false;
+        getMathsKernels().hexToBinary(aHex, aHexLength, static_cast<uint8_t*>(aBinary) + aBinaryLength);
         return true;
     }
 
@@ -28,11 +28,12 @@
 	\version 1.0
 	\date
 	Created			: 26th September 2015
-	Last Modified	: 15th November 2015
+	Last Modified	: 16th October 2026
 */
 
 #include <cstdint>
 #include "Solaire\Core\Maths.hpp"
+#include "CpuDispatch.hpp"
 
 namespace Solaire{
 
@@ -71,33 +72,12 @@ namespace Solaire{
 			popCount32(aValue & INT_0);
     }
 
-	static uint32_t popCount(const void* const aSrc, uint32_t aBytes) {
-		uint32_t count = 0;
-		const uint8_t* src = static_cast<const uint8_t*>(aSrc);
-
-		while(aBytes >= 8) {
-			count += popCount64(*reinterpret_cast<const uint64_t*>(src));
-			src += 8;
-			aBytes -= 8;
-		}
-
-		if(aBytes >= 4) {
-			count += popCount32(*reinterpret_cast<const uint32_t*>(src));
-			src += 4;
-			aBytes -= 4;
-		}
-
-		if(aBytes >= 2) {
-			count += popCount16(*reinterpret_cast<const uint16_t*>(src));
-			src += 2;
-			aBytes -= 2;
-		}
-
-		if(aBytes == 1) {
-			count += popCount8(*src);
-		}
-
-		return count;
+	/*!
+		\brief Count the set bits in a block of memory.
+		\details Uses the fastest kernel for the processor, see getMathsKernels.
+	*/
+	static uint32_t popCount(const void* const aSrc, const uint32_t aBytes) {
+		return getMathsKernels().popCount(aSrc, aBytes);
 	}
 
 	template<class T>
@@ -28,11 +28,12 @@
 	\version 1.0
 	\date
 	Created			: 26th September 2015
-	Last Modified	: 15th November 2015
+	Last Modified	: 16th October 2026
 */
 
 #include <cstdint>
 #include "Solaire\Core\Maths.hpp"
+#include "CpuDispatch.hpp"
 
 namespace Solaire {
 
@@ -63,7 +64,7 @@ namespace Solaire {
 			59,	    187,	123,	251,	7,	    135,	71,	    199,	39,	    167,
 			103,	231,	23,	    151,	87,	    215,	55,	    183,	119,	247,
 			15,	    143,	79,	    207,	47,	    175,	111,	239,	31,	    159,
-			95,	    23,	    63,	    191,	127,	255
+			95,	    223,	63,	    191,	127,	255
 		};
     }
 
@@ -78,7 +79,7 @@ namespace Solaire {
 	static constexpr uint16_t reflect16(const uint16_t aValue) throw() {
 		return
 			static_cast<uint16_t>(reflect8(aValue >> 8)) |
-			(static_cast<uint16_t>(reflect8(aValue & NYBBLE_0)) << 8);
+			(static_cast<uint16_t>(reflect8(aValue & BYTE_0)) << 8);
     }
 
 	static constexpr uint32_t reflect32(const uint32_t aValue) throw() {
@@ -87,40 +88,21 @@ namespace Solaire {
 			(static_cast<uint32_t>(reflect16(aValue & SHORT_0)) << 16);
     }
 
-    static constexpr uint8_t reflect64(const uint64_t aValue) throw() {
+    static constexpr uint64_t reflect64(const uint64_t aValue) throw() {
 		return
-			static_cast<uint32_t>(reflect32(aValue >> 32L)) |
-			(static_cast<uint32_t>(reflect32(aValue & INT_0)) << 32L);
+			static_cast<uint64_t>(reflect32(aValue >> 32L)) |
+			(static_cast<uint64_t>(reflect32(aValue & INT_0)) << 32L);
     }
 
-	static void reflect(void* const aDst, const void* const aSrc, uint32_t aBytes) {
-		uint8_t* dst = static_cast<uint8_t*>(aDst) + aBytes - 1;
-		const uint8_t* src = static_cast<const uint8_t*>(aSrc);
-
-		while(aBytes >= 8) {
-			*reinterpret_cast<uint64_t*>(dst) = reflect64(*reinterpret_cast<const uint64_t*>(src));
-			dst -= 8;
-			src += 8;
-			aBytes -= 8;
-		}
-
-		if(aBytes >= 4) {
-			*reinterpret_cast<uint32_t*>(dst) = reflect32(*reinterpret_cast<const uint32_t*>(src));
-			dst -= 4;
-			src += 4;
-			aBytes -= 4;
-		}
-
-		if(aBytes >= 2) {
-			*reinterpret_cast<uint16_t*>(dst) = reflect16(*reinterpret_cast<const uint16_t*>(src));
-			dst -= 2;
-			src += 2;
-			aBytes -= 2;
-		}
-
-		if(aBytes == 1) {
-			*dst = reflect8(*src);
-		}
+	/*!
+		\brief Reverse the order of all of the bits in a block of memory.
+		\details The first bit of aSrc becomes the last bit of aDst. Uses the fastest kernel for the processor, see getMathsKernels.
+		\param aDst The address to write the reflected data, which must not overlap aSrc.
+		\param aSrc The data to reflect.
+		\param aBytes The number of bytes to reflect.
+	*/
+	static void reflect(void* const aDst, const void* const aSrc, const uint32_t aBytes) {
+		getMathsKernels().reflect(aDst, aSrc, aBytes);
 	}
 
 	template<class T>
@@ -0,0 +1,203 @@
+#ifndef SOLAIRE_HASH_ISTREAM_HPP
+#define SOLAIRE_HASH_ISTREAM_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file HashIStream.hpp
+	\brief Verify a checksum as data is read.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\date
+	Created			: 16th October 2026
+	Last Modified	: 16th October 2026
+*/
+
+#include "Solaire/Core/IStream.hpp"
+#include "Solaire/Maths/Hash/HashFunction.hpp"
+
+namespace Solaire {
+
+    /*!
+        \brief Forwards reads from another stream, updates a hash state with every byte read and compares it against an
+        expected checksum when the stream ends.
+        \details
+        When the underlying stream is offsetable the number of bytes hashed after each read is taken from the change in
+        offset, so a read that runs past the end only hashes the bytes that existed. Otherwise reads must not run past the
+        end of the stream. Moving the offset would make the
+        hash disagree with the data, so setOffset only succeeds when the offset does not change.
+    */
+	template<class HASH_TYPE>
+	class VerifyingIStream : public IStream {
+    public:
+        typedef HASH_TYPE HashType;
+    private:
+        IStream& mStream;
+        HashState<HashType>& mState;
+        uint64_t mBytes;
+        HashType mExpected;
+        bool mChecked;
+        bool mMatched;
+    private:
+        template<class T>
+        T readValue() throw() {
+            T value;
+            read(&value, sizeof(T));
+            return value;
+        }
+
+        void check() throw() {
+            if(mChecked || ! mStream.end()) return;
+            mChecked = true;
+            mMatched = mState.Finalise() == mExpected;
+        }
+
+        // Inherited from IStream
+
+        uint8_t SOLAIRE_EXPORT_CALL readU8() throw() override {
+            return readValue<uint8_t>();
+        }
+
+        uint16_t SOLAIRE_EXPORT_CALL readU16() throw() override {
+            return readValue<uint16_t>();
+        }
+
+        uint32_t SOLAIRE_EXPORT_CALL readU32() throw() override {
+            return readValue<uint32_t>();
+        }
+
+        uint64_t SOLAIRE_EXPORT_CALL readU64() throw() override {
+            return readValue<uint64_t>();
+        }
+
+        int8_t SOLAIRE_EXPORT_CALL readI8() throw() override {
+            return readValue<int8_t>();
+        }
+
+        int16_t SOLAIRE_EXPORT_CALL readI16() throw() override {
+            return readValue<int16_t>();
+        }
+
+        int32_t SOLAIRE_EXPORT_CALL readI32() throw() override {
+            return readValue<int32_t>();
+        }
+
+        int64_t SOLAIRE_EXPORT_CALL readI64() throw() override {
+            return readValue<int64_t>();
+        }
+
+        float SOLAIRE_EXPORT_CALL readF() throw() override {
+            return readValue<float>();
+        }
+
+        double SOLAIRE_EXPORT_CALL readD() throw() override {
+            return readValue<double>();
+        }
+
+        char SOLAIRE_EXPORT_CALL readC() throw() override {
+            return readValue<char>();
+        }
+
+    public:
+        /*!
+            \param aStream The stream to read from.
+            \param aState The hash state, which should already be initialised.
+            \param aExpected The checksum of the whole stream.
+        */
+        VerifyingIStream(IStream& aStream, HashState<HashType>& aState, const HashType aExpected) :
+            mStream(aStream),
+            mState(aState),
+            mBytes(0),
+            mExpected(aExpected),
+            mChecked(false),
+            mMatched(false)
+        {
+            check();
+        }
+
+        SOLAIRE_EXPORT_CALL ~VerifyingIStream() {
+
+        }
+
+        /*!
+            \brief The hash of the data read so far.
+        */
+        HashType getHash() const throw() {
+            return mState.Finalise();
+        }
+
+        uint64_t getBytesRead() const throw() {
+            return mBytes;
+        }
+
+        /*!
+            \brief Check if the end of the stream has been reached and the data matched the expected checksum.
+            \return False until the end of the stream is reached, or if the checksum did not match.
+        */
+        bool isVerified() const throw() {
+            return mChecked && mMatched;
+        }
+
+        /*!
+            \brief Check if the end of the stream has been reached and the data did not match the expected checksum.
+        */
+        bool isCorrupt() const throw() {
+            return mChecked && ! mMatched;
+        }
+
+        // Inherited from IStream
+
+        void SOLAIRE_EXPORT_CALL read(void* const aAddress, const uint32_t aBytes) throw() override {
+            uint32_t bytes = aBytes;
+            if(mStream.isOffsetable()) {
+                const uint32_t before = static_cast<uint32_t>(mStream.getOffset());
+                mStream.read(aAddress, aBytes);
+                const uint32_t read = static_cast<uint32_t>(mStream.getOffset()) - before;
+                if(read < bytes) bytes = read;
+            }else {
+                mStream.read(aAddress, aBytes);
+            }
+
+            mState.Update(aAddress, bytes);
+            mBytes += bytes;
+            check();
+        }
+
+        bool SOLAIRE_EXPORT_CALL isOffsetable() const throw() override {
+            return mStream.isOffsetable();
+        }
+
+        int32_t SOLAIRE_EXPORT_CALL getOffset() const throw() override {
+            return mStream.getOffset();
+        }
+
+        bool SOLAIRE_EXPORT_CALL setOffset(const int32_t aOffset) throw() override {
+            return aOffset == mStream.getOffset();
+        }
+
+        bool SOLAIRE_EXPORT_CALL end() const throw() override {
+            return mStream.end();
+        }
+
+    };
+
+}
+
+#endif
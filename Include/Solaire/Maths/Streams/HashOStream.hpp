@@ -0,0 +1,157 @@
+#ifndef SOLAIRE_HASH_OSTREAM_HPP
+#define SOLAIRE_HASH_OSTREAM_HPP
+
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+/*!
+	\file HashOStream.hpp
+	\brief Checksum data as it is written.
+	\author
+	Created			: Adam Smith
+	Last modified	: Adam Smith
+	\date
+	Created			: 16th October 2026
+	Last Modified	: 16th October 2026
+*/
+
+#include "Solaire/Core/OStream.hpp"
+#include "Solaire/Maths/Hash/HashFunction.hpp"
+
+namespace Solaire {
+
+    /*!
+        \brief Forwards data to another stream and updates a hash state with every byte written.
+        \details
+        The state is not initialised by the stream, so a checksum can continue over several streams. Moving the offset
+        would make the hash disagree with the data, so setOffset only succeeds when the offset does not change.
+    */
+	template<class HASH_TYPE>
+	class HashingOStream : public OStream {
+    public:
+        typedef HASH_TYPE HashType;
+    private:
+        OStream& mStream;
+        HashState<HashType>& mState;
+        uint64_t mBytes;
+    private:
+        template<class T>
+        void writeValue(const T aValue) throw() {
+            write(&aValue, sizeof(T));
+        }
+
+        // Inherited from OStream
+
+        void SOLAIRE_EXPORT_CALL writeU8(const uint8_t aValue) throw() override {
+            writeValue(aValue);
+        }
+
+        void SOLAIRE_EXPORT_CALL writeU16(const uint16_t aValue) throw() override {
+            writeValue(aValue);
+        }
+
+        void SOLAIRE_EXPORT_CALL writeU32(const uint32_t aValue) throw() override {
+            writeValue(aValue);
+        }
+
+        void SOLAIRE_EXPORT_CALL writeU64(const uint64_t aValue) throw() override {
+            writeValue(aValue);
+        }
+
+        void SOLAIRE_EXPORT_CALL writeI8(const int8_t aValue) throw() override {
+            writeValue(aValue);
+        }
+
+        void SOLAIRE_EXPORT_CALL writeI16(const int16_t aValue) throw() override {
+            writeValue(aValue);
+        }
+
+        void SOLAIRE_EXPORT_CALL writeI32(const int32_t aValue) throw() override {
+            writeValue(aValue);
+        }
+
+        void SOLAIRE_EXPORT_CALL writeI64(const int64_t aValue) throw() override {
+            writeValue(aValue);
+        }
+
+        void SOLAIRE_EXPORT_CALL writeF(const float aValue) throw() override {
+            writeValue(aValue);
+        }
+
+        void SOLAIRE_EXPORT_CALL writeD(const double aValue) throw() override {
+            writeValue(aValue);
+        }
+
+        void SOLAIRE_EXPORT_CALL writeC(const char aValue) throw() override {
+            writeValue(aValue);
+        }
+
+    public:
+        HashingOStream(OStream& aStream, HashState<HashType>& aState) :
+            mStream(aStream),
+            mState(aState),
+            mBytes(0)
+        {}
+
+        SOLAIRE_EXPORT_CALL ~HashingOStream() {
+
+        }
+
+        /*!
+            \brief The hash of the data written so far.
+        */
+        HashType getHash() const throw() {
+            return mState.Finalise();
+        }
+
+        uint64_t getBytesWritten() const throw() {
+            return mBytes;
+        }
+
+        /*!
+            \brief Initialise the hash state to begin a new checksum.
+        */
+        void reset() throw() {
+            mState.Initialise();
+            mBytes = 0;
+        }
+
+        // Inherited from OStream
+
+        void SOLAIRE_EXPORT_CALL write(const void* const aPtr, const uint32_t aBytes) throw() override {
+            mStream.write(aPtr, aBytes);
+            mState.Update(aPtr, aBytes);
+            mBytes += aBytes;
+        }
+
+        bool SOLAIRE_EXPORT_CALL isOffsetable() const throw() override {
+            return mStream.isOffsetable();
+        }
+
+        int32_t SOLAIRE_EXPORT_CALL getOffset() const throw() override {
+            return mStream.getOffset();
+        }
+
+        bool SOLAIRE_EXPORT_CALL setOffset(const int32_t aOffset) throw() override {
+            return aOffset == mStream.getOffset();
+        }
+    };
+
+}
+
+#endif
@@ -19,6 +19,7 @@
 #include <iostream>
 #include <cstring>
 #include "Solaire\Maths\Base64.hpp"
+#include "Solaire\Maths\CpuDispatch.hpp"
 
 namespace Solaire{
 
@@ -37,27 +38,9 @@ namespace Solaire{
 		\return The number of bytes required to encode the data into Base64.
 	*/
     uint32_t Base64::UnpaddedEncodeLength(const uint32_t aLength) {
-        //! \todo Optimise UnpaddedEncodeLength
-
-		uint32_t input = 0;
-		uint32_t output = 0;
-
-		while(input < aLength) {
-    		++output;
-    		if(input + 1 < aLength) {
-    			++output;
-    			if(input + 2 < aLength) {
-    				output += 2;
-    			}else {
-    				++output;
-    			}
-    		}else{
-    			++output;
-    		}
-    		input += 3;
-    	}
-
-    	return output;
+        // Each group of 3 bytes becomes 4 characters, a partial group of n bytes becomes n + 1 characters
+        const uint32_t remainder = aLength % 3;
+        return (aLength / 3) * 4 + (remainder == 0 ? 0 : remainder + 1);
 	}
 
 	/*!
@@ -66,14 +49,8 @@ namespace Solaire{
 		\return The number of bytes required to decode the data from Base64.
 	*/
 	uint32_t Base64::UnpaddedDecodeLength(const uint32_t aLength) {
-        //! \todo Optimise UnpaddedDecodeLength
-        uint32_t i = 0;
-        uint32_t length = 0;
-        while(length != aLength){
-            length = UnpaddedEncodeLength(i);
-            ++i;
-        }
-        return i - 1;
+        const uint32_t remainder = aLength & 3;
+        return (aLength / 4) * 3 + (remainder == 0 ? 0 : remainder - 1);
 	}
 
 
@@ -120,142 +97,65 @@ namespace Solaire{
 	}
 
     char* Base64::Encode(char* aOutput, const uint32_t aOutputLength, const void* const aInput, const uint32_t aInputLength, const char* const aBase64, const char* const aPadding) {
-		const uint32_t outputLength = UnpaddedEncodeLength(aInputLength) + aPadding ? UnpaddedPaddingBytes(aInputLength) : 0;
+		const uint32_t unpaddedLength = UnpaddedEncodeLength(aInputLength);
+		const uint32_t outputLength = unpaddedLength + (aPadding ? UnpaddedPaddingBytes(unpaddedLength) : 0);
     	if (aOutputLength < outputLength) {
     		return nullptr;
     	}
-    
-    	const char* input = static_cast<const char*>(aInput);
-    	const char* const end = input + aInputLength;
-    
-    	uint8_t b;
-    	while (input < end) {
-    		b = (*input & 0xFC) >> 2;
-    		*aOutput = aBase64[b];
-    		++aOutput;
-    		b = (*input & 0x03) << 4;
-    
-    		if (input + 1 < end) {
-    			b |= (input[1] & 0xF0) >> 4;
-    			*aOutput = aBase64[b];
-    			++aOutput;
-    			b = (input[1] & 0x0F) << 2;
-    			if (input + 2 < end) {
-    				b |= (input[2] & 0xC0) >> 6;
-    				*aOutput = aBase64[b];
-    				++aOutput;
-    				b = input[2] & 0x3F;
-    				*aOutput = aBase64[b];
-    				++aOutput;
-    			}
-    			else {
-    				*aOutput = aBase64[b];
-    				++aOutput;
-    				 if(aPadding){
-    				    *aOutput = *aPadding;
-    			    	++aOutput;
-    				 }
-    			}
+
+    	return getMathsKernels().base64Encode(aOutput, static_cast<const uint8_t*>(aInput), aInputLength, aBase64, aPadding);
+    }
+
+    /*!
+        \brief Decode characters that have had their padding removed.
+    */
+    static char* DecodeBase64(char* aOutput, const uint32_t aOutputLength, const char* const aInput, const uint32_t aInputLength, const char* const aBase64) {
+    	if (aOutputLength < Base64::UnpaddedDecodeLength(aInputLength)) {
+    		return nullptr;
+    	}
+
+    	// Whole groups of 4 characters go to the kernel, the last partial group is decoded here
+    	const uint32_t groupLength = aInputLength & ~3u;
+    	aOutput = getMathsKernels().base64Decode(aOutput, aInput, groupLength, aBase64);
+
+    	const uint32_t remainder = aInputLength - groupLength;
+    	if(remainder >= 2) {
+    		uint8_t b[3] = { 0, 0, 0 };
+    		for(uint32_t i = 0; i < remainder; ++i) {
+    			const void* const c = std::memchr(aBase64, aInput[groupLength + i], 64);
+    			b[i] = c ? static_cast<uint8_t>(static_cast<const char*>(c) - aBase64) : 0;
     		}
-    		else {
-    			*aOutput = aBase64[b];
+    		*aOutput = static_cast<char>((b[0] << 2) | (b[1] >> 4));
+    		++aOutput;
+    		if(remainder == 3) {
+    			*aOutput = static_cast<char>((b[1] << 4) | (b[2] >> 2));
     			++aOutput;
-    			 if(aPadding){
-        			*aOutput = *aPadding;
-        			++aOutput;
-        			*aOutput = *aPadding;
-        			++aOutput;
-    			 }
     		}
-    
-    		input += 3;
     	}
-    
+
     	return aOutput;
     }
-    
+
     static char* DecodeBase64WithPadding(char* aOutput, const uint32_t aOutputLength, const void* const aInput, const uint32_t aInputLength, const char* const aBase64, const char aPadding) {
     	if((aInputLength & 3) != 0) {
     		return nullptr;
     	}
-    	const char* input = static_cast<const char*>(aInput);
-    	const char* const end = input + aInputLength;
+    	if(aInputLength == 0) {
+    		return aOutput;
+    	}
+    	const char* const input = static_cast<const char*>(aInput);
 
     	const uint32_t paddingBytes =
             input[aInputLength - 2] == aPadding ? 2 :
             input[aInputLength - 1] == aPadding ? 1 :
             0;
 
-    	const uint32_t outputLength = Base64::UnpaddedDecodeLength(aInputLength - paddingBytes);
-
-    	if (aOutputLength < outputLength) {
-    		return nullptr;
-    	}
-    
-
-    	uint8_t b[4];
-    	while (input != end) {
-    		//! \todo Pre-calculate?
-    		b[0] = std::strchr(aBase64, input[0]) - aBase64;
-    		b[1] = std::strchr(aBase64, input[1]) - aBase64;
-    		b[2] = std::strchr(aBase64, input[2]) - aBase64;
-    		b[3] = std::strchr(aBase64, input[3]) - aBase64;
-    		*aOutput = static_cast<char>((b[0] << 2) | (b[1] >> 4));
-    		++aOutput;
-    		if (b[2] < 64) {
-    			*aOutput = static_cast<char>((b[1] << 4) | (b[2] >> 2));
-    			++aOutput;
-    			if (b[3] < 64) {
-    				*aOutput = static_cast<char>((b[2] << 6) | b[3]);
-    				++aOutput;
-    			}
-    		}
-    
-    		input += 4;
-    	}
-    
-    	return aOutput;
+    	return DecodeBase64(aOutput, aOutputLength, input, aInputLength - paddingBytes, aBase64);
     }
-    
-    static char* DecodeBase64WithoutPadding(char* aOutput, const uint32_t aOutputLength, const void* const aInput, const uint32_t aInputLength, const char* const aBase64) {
-    	//! \todo Optimise DecodeBase64WithoutPadding
-
-		const char paddingChar = *BASE_64_STANDARD_PADDING;
-		const uint32_t padding = Base64::UnpaddedPaddingBytes(aInputLength);
-
-		char* output = nullptr;
-
-		if(padding > 0) {
-			char* const buf = new char[aInputLength + 3];
-			std::memcpy(buf, aInput, aInputLength);
 
-			if(padding == 1) {
-				buf[aInputLength] = paddingChar;
-				buf[aInputLength + 1] = '\0';
-			}else if(padding == 2) {
-				buf[aInputLength] = paddingChar;
-				buf[aInputLength + 1] = paddingChar;
-				buf[aInputLength + 2] = '\0';
-			}
-
-			char base64[66];
-			std::memcpy(base64, aBase64, 64);
-			base64[64] = '=';
-			base64[65] = '\0';
-
-			output = DecodeBase64WithPadding(aOutput, aOutputLength, buf, aInputLength + padding, base64, paddingChar);
-
-			delete buf;
-		}else{
-			output = DecodeBase64WithPadding(aOutput, aOutputLength, aInput, aInputLength, aBase64, paddingChar);
-		}
-
-    	return output;
-    }
-    
     char* Base64::Decode(char* aOutput, const uint32_t aOutputLength, const void* const aInput, const uint32_t aInputLength, const char* const aBase64, const char* const aPadding) {
-    	return aPadding ? 
+    	return aPadding ?
     	    DecodeBase64WithPadding(aOutput, aOutputLength, aInput, aInputLength, aBase64, *aPadding) :
-    	    DecodeBase64WithoutPadding(aOutput, aOutputLength, aInput, aInputLength, aBase64);
+    	    DecodeBase64(aOutput, aOutputLength, static_cast<const char*>(aInput), aInputLength, aBase64);
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,567 @@
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+#include <cstdlib>
+#include <cstring>
+#include "Solaire\Maths\CpuDispatch.hpp"
+#include "Solaire\Maths\Reflect.hpp"
+#include "Solaire\Maths\Hex.hpp"
+#include "Solaire\Maths\Hash\Crc.hpp"
+
+#if SOLAIRE_RUNTIME_DISPATCH
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#endif
+
+namespace Solaire{
+
+    namespace CpuDispatchImplementation {
+
+        static const char* const FEATURE_NAMES[CPU_FEATURE_COUNT] = {
+            "sse2",
+            "ssse3",
+            "sse4.2",
+            "pclmul",
+            "popcnt",
+            "avx2",
+            "bmi2",
+            "avx512f",
+            "avx512bw",
+            "sha"
+        };
+
+#if SOLAIRE_RUNTIME_DISPATCH
+        static void Cpuid(const uint32_t aLeaf, const uint32_t aSubLeaf, uint32_t* const aRegisters) throw() {
+    #if defined(_MSC_VER)
+            int registers[4];
+            __cpuidex(registers, static_cast<int>(aLeaf), static_cast<int>(aSubLeaf));
+            for(int i = 0; i < 4; ++i) aRegisters[i] = static_cast<uint32_t>(registers[i]);
+    #else
+            __cpuid_count(aLeaf, aSubLeaf, aRegisters[0], aRegisters[1], aRegisters[2], aRegisters[3]);
+    #endif
+        }
+
+        /*!
+            \brief Read the register that shows which register states the operating system saves.
+        */
+        static uint64_t ReadXcr0() throw() {
+    #if defined(_MSC_VER)
+            return _xgetbv(0);
+    #else
+            uint32_t low;
+            uint32_t high;
+            __asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+            return (static_cast<uint64_t>(high) << 32) | low;
+    #endif
+        }
+#endif
+
+        static inline uint64_t Read64(const uint8_t* const aData) throw() {
+            uint64_t tmp;
+            std::memcpy(&tmp, aData, sizeof(uint64_t));
+            return tmp;
+        }
+
+        static inline void Write64(uint8_t* const aData, const uint64_t aValue) throw() {
+            std::memcpy(aData, &aValue, sizeof(uint64_t));
+        }
+
+        // popCount
+
+        static inline uint32_t PopCount64(uint64_t aValue) throw() {
+            aValue = aValue - ((aValue >> 1) & 0x5555555555555555ULL);
+            aValue = (aValue & 0x3333333333333333ULL) + ((aValue >> 2) & 0x3333333333333333ULL);
+            aValue = (aValue + (aValue >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+            return static_cast<uint32_t>((aValue * 0x0101010101010101ULL) >> 56);
+        }
+
+        static uint32_t PopCountScalar(const void* const aSrc, const uint32_t aBytes) {
+            const uint8_t* const src = static_cast<const uint8_t*>(aSrc);
+            uint32_t count = 0;
+            uint32_t i = 0;
+            for(; i + 8 <= aBytes; i += 8) count += PopCount64(Read64(src + i));
+            for(; i < aBytes; ++i) count += PopCount64(src[i]);
+            return count;
+        }
+
+#if SOLAIRE_RUNTIME_DISPATCH
+        SOLAIRE_TARGET("popcnt")
+        static uint32_t PopCountPopcnt(const void* const aSrc, const uint32_t aBytes) {
+            const uint8_t* const src = static_cast<const uint8_t*>(aSrc);
+
+            // Separate accumulators so that the instructions are not serialised by a single register
+            uint64_t count0 = 0;
+            uint64_t count1 = 0;
+            uint64_t count2 = 0;
+            uint64_t count3 = 0;
+            uint32_t i = 0;
+            for(; i + 32 <= aBytes; i += 32) {
+                count0 += _mm_popcnt_u64(Read64(src + i));
+                count1 += _mm_popcnt_u64(Read64(src + i + 8));
+                count2 += _mm_popcnt_u64(Read64(src + i + 16));
+                count3 += _mm_popcnt_u64(Read64(src + i + 24));
+            }
+            for(; i + 8 <= aBytes; i += 8) count0 += _mm_popcnt_u64(Read64(src + i));
+            for(; i < aBytes; ++i) count0 += _mm_popcnt_u64(src[i]);
+            return static_cast<uint32_t>(count0 + count1 + count2 + count3);
+        }
+
+        /*!
+            \brief Count the bits of each nybble with a shuffle and sum the bytes with vpsadbw (Mula, Kurz and Lemire).
+        */
+        SOLAIRE_TARGET("avx2")
+        static uint32_t PopCountAvx2(const void* const aSrc, const uint32_t aBytes) {
+            const uint8_t* const src = static_cast<const uint8_t*>(aSrc);
+            const __m256i table = _mm256_setr_epi8(
+                0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4
+            );
+            const __m256i low = _mm256_set1_epi8(0x0F);
+            __m256i total = _mm256_setzero_si256();
+
+            uint32_t i = 0;
+            for(; i + 32 <= aBytes; i += 32) {
+                const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                const __m256i counts = _mm256_add_epi8(
+                    _mm256_shuffle_epi8(table, _mm256_and_si256(block, low)),
+                    _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(block, 4), low))
+                );
+                total = _mm256_add_epi64(total, _mm256_sad_epu8(counts, _mm256_setzero_si256()));
+            }
+
+            uint64_t lanes[4];
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), total);
+            return static_cast<uint32_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]) + PopCountScalar(src + i, aBytes - i);
+        }
+#endif
+
+        // reflect
+
+        static inline uint64_t Reflect64(uint64_t aValue) throw() {
+            aValue = ((aValue >> 1) & 0x5555555555555555ULL) | ((aValue & 0x5555555555555555ULL) << 1);
+            aValue = ((aValue >> 2) & 0x3333333333333333ULL) | ((aValue & 0x3333333333333333ULL) << 2);
+            aValue = ((aValue >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((aValue & 0x0F0F0F0F0F0F0F0FULL) << 4);
+            aValue = ((aValue >> 8) & 0x00FF00FF00FF00FFULL) | ((aValue & 0x00FF00FF00FF00FFULL) << 8);
+            aValue = ((aValue >> 16) & 0x0000FFFF0000FFFFULL) | ((aValue & 0x0000FFFF0000FFFFULL) << 16);
+            return (aValue >> 32) | (aValue << 32);
+        }
+
+        static void ReflectScalar(void* const aDst, const void* const aSrc, const uint32_t aBytes) {
+            uint8_t* const dst = static_cast<uint8_t*>(aDst);
+            const uint8_t* const src = static_cast<const uint8_t*>(aSrc);
+            uint32_t i = 0;
+            for(; i + 8 <= aBytes; i += 8) Write64(dst + aBytes - 8 - i, Reflect64(Read64(src + i)));
+            for(; i < aBytes; ++i) dst[aBytes - 1 - i] = reflect8(src[i]);
+        }
+
+#if SOLAIRE_RUNTIME_DISPATCH
+        SOLAIRE_TARGET("ssse3")
+        static inline __m128i ReflectBlock(const __m128i aBlock) throw() {
+            const __m128i table = _mm_setr_epi8(0, 8, 4, 12, 2, 10, 6, 14, 1, 9, 5, 13, 3, 11, 7, 15);
+            const __m128i low = _mm_set1_epi8(0x0F);
+            const __m128i reversed = _mm_shuffle_epi8(aBlock, _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+            return _mm_or_si128(
+                _mm_slli_epi16(_mm_shuffle_epi8(table, _mm_and_si128(reversed, low)), 4),
+                _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(reversed, 4), low))
+            );
+        }
+
+        SOLAIRE_TARGET("ssse3")
+        static void ReflectSsse3(void* const aDst, const void* const aSrc, const uint32_t aBytes) {
+            uint8_t* const dst = static_cast<uint8_t*>(aDst);
+            const uint8_t* const src = static_cast<const uint8_t*>(aSrc);
+            uint32_t i = 0;
+            for(; i + 16 <= aBytes; i += 16) {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + aBytes - 16 - i), ReflectBlock(block));
+            }
+            for(; i < aBytes; ++i) dst[aBytes - 1 - i] = reflect8(src[i]);
+        }
+
+        SOLAIRE_TARGET("avx2")
+        static void ReflectAvx2(void* const aDst, const void* const aSrc, const uint32_t aBytes) {
+            uint8_t* const dst = static_cast<uint8_t*>(aDst);
+            const uint8_t* const src = static_cast<const uint8_t*>(aSrc);
+            const __m256i table = _mm256_setr_epi8(
+                0, 8, 4, 12, 2, 10, 6, 14, 1, 9, 5, 13, 3, 11, 7, 15,
+                0, 8, 4, 12, 2, 10, 6, 14, 1, 9, 5, 13, 3, 11, 7, 15
+            );
+            const __m256i order = _mm256_setr_epi8(
+                15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+                15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0
+            );
+            const __m256i low = _mm256_set1_epi8(0x0F);
+
+            uint32_t i = 0;
+            for(; i + 32 <= aBytes; i += 32) {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                // Reverse the bytes of each lane then swap the lanes
+                block = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(block, order), 0x4E);
+                block = _mm256_or_si256(
+                    _mm256_slli_epi16(_mm256_shuffle_epi8(table, _mm256_and_si256(block, low)), 4),
+                    _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(block, 4), low))
+                );
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + aBytes - 32 - i), block);
+            }
+            for(; i < aBytes; ++i) dst[aBytes - 1 - i] = reflect8(src[i]);
+        }
+#endif
+
+        // binaryToHex and hexToBinary, the binary data is a little endian number so the last byte is written first
+
+        static void BinaryToHexScalar(const void* const aBinary, const uint32_t aBinaryLength, char* const aHex) {
+            const uint8_t* const bin = static_cast<const uint8_t*>(aBinary);
+            for(uint32_t i = 0; i < aBinaryLength; ++i) bin8ToHex(bin[aBinaryLength - 1 - i], aHex + i * 2);
+        }
+
+        static void HexToBinaryScalar(const char* const aHex, const uint32_t aHexLength, uint8_t* const aBinaryEnd) {
+            const uint32_t pairs = aHexLength / 2;
+            uint8_t* bin = aBinaryEnd;
+            for(uint32_t i = 0; i < pairs; ++i) *--bin = hexToBin8(aHex + i * 2);
+            if(aHexLength & 1) *--bin = static_cast<uint8_t>(hexToBin4(aHex[aHexLength - 1]) << 4);
+        }
+
+#if SOLAIRE_RUNTIME_DISPATCH
+        SOLAIRE_TARGET("ssse3")
+        static void BinaryToHexSsse3(const void* const aBinary, const uint32_t aBinaryLength, char* const aHex) {
+            const uint8_t* const bin = static_cast<const uint8_t*>(aBinary);
+            const __m128i digits = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F');
+            const __m128i order = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+            const __m128i low = _mm_set1_epi8(0x0F);
+
+            uint32_t i = 0;
+            for(; i + 16 <= aBinaryLength; i += 16) {
+                const __m128i block = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(bin + aBinaryLength - 16 - i)), order);
+                const __m128i high = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(block, 4), low));
+                const __m128i lowDigits = _mm_shuffle_epi8(digits, _mm_and_si128(block, low));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(aHex + i * 2), _mm_unpacklo_epi8(high, lowDigits));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(aHex + i * 2 + 16), _mm_unpackhi_epi8(high, lowDigits));
+            }
+            BinaryToHexScalar(bin, aBinaryLength - i, aHex + i * 2);
+        }
+
+        SOLAIRE_TARGET("avx2")
+        static void BinaryToHexAvx2(const void* const aBinary, const uint32_t aBinaryLength, char* const aHex) {
+            const uint8_t* const bin = static_cast<const uint8_t*>(aBinary);
+            const __m256i digits = _mm256_setr_epi8(
+                '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F',
+                '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'
+            );
+            const __m256i order = _mm256_setr_epi8(
+                15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+                15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0
+            );
+            const __m256i low = _mm256_set1_epi8(0x0F);
+
+            uint32_t i = 0;
+            for(; i + 32 <= aBinaryLength; i += 32) {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bin + aBinaryLength - 32 - i));
+                block = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(block, order), 0x4E);
+                const __m256i high = _mm256_shuffle_epi8(digits, _mm256_and_si256(_mm256_srli_epi16(block, 4), low));
+                const __m256i lowDigits = _mm256_shuffle_epi8(digits, _mm256_and_si256(block, low));
+                // Unpacking works within each lane, so the halves are put back in order afterwards
+                const __m256i first = _mm256_unpacklo_epi8(high, lowDigits);
+                const __m256i second = _mm256_unpackhi_epi8(high, lowDigits);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(aHex + i * 2), _mm256_permute2x128_si256(first, second, 0x20));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(aHex + i * 2 + 32), _mm256_permute2x128_si256(first, second, 0x31));
+            }
+            BinaryToHexSsse3(bin, aBinaryLength - i, aHex + i * 2);
+        }
+
+        /*!
+            \brief Convert 16 hexadecimal characters into nybble values.
+            \return False if any character is not a hexadecimal digit.
+        */
+        SOLAIRE_TARGET("ssse3")
+        static inline bool HexDigits(const __m128i aChars, __m128i& aValues) throw() {
+            const __m128i lower = _mm_or_si128(aChars, _mm_set1_epi8(0x20));
+            const __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(aChars, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(aChars, _mm_set1_epi8('9' + 1)));
+            const __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+            aValues = _mm_add_epi8(_mm_and_si128(aChars, _mm_set1_epi8(0x0F)), _mm_and_si128(letter, _mm_set1_epi8(9)));
+            return _mm_movemask_epi8(_mm_or_si128(digit, letter)) == 0xFFFF;
+        }
+
+        SOLAIRE_TARGET("ssse3")
+        static void HexToBinarySsse3(const char* const aHex, const uint32_t aHexLength, uint8_t* const aBinaryEnd) {
+            const __m128i order = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+            const __m128i weights = _mm_set1_epi16(0x0110);
+
+            uint32_t i = 0;
+            for(; i + 32 <= aHexLength; i += 32) {
+                uint8_t* const bin = aBinaryEnd - i / 2 - 16;
+                __m128i first;
+                __m128i second;
+                const bool valid =
+                    HexDigits(_mm_loadu_si128(reinterpret_cast<const __m128i*>(aHex + i)), first) &
+                    HexDigits(_mm_loadu_si128(reinterpret_cast<const __m128i*>(aHex + i + 16)), second);
+
+                // Characters that are not digits convert to 0, which the table already handles
+                if(! valid) {
+                    HexToBinaryScalar(aHex + i, 32, bin + 16);
+                    continue;
+                }
+
+                // Each pair of nybbles becomes high * 16 + low
+                const __m128i bytes = _mm_packus_epi16(_mm_maddubs_epi16(first, weights), _mm_maddubs_epi16(second, weights));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(bin), _mm_shuffle_epi8(bytes, order));
+            }
+            HexToBinaryScalar(aHex + i, aHexLength - i, aBinaryEnd - i / 2);
+        }
+#endif
+
+        // Base64
+
+        static char* Base64EncodeScalar(char* aOutput, const uint8_t* const aInput, const uint32_t aInputLength, const char* const aBase64, const char* const aPadding) {
+            uint32_t i = 0;
+            for(; i + 3 <= aInputLength; i += 3) {
+                const uint32_t group = (static_cast<uint32_t>(aInput[i]) << 16) | (static_cast<uint32_t>(aInput[i + 1]) << 8) | aInput[i + 2];
+                aOutput[0] = aBase64[group >> 18];
+                aOutput[1] = aBase64[(group >> 12) & 63];
+                aOutput[2] = aBase64[(group >> 6) & 63];
+                aOutput[3] = aBase64[group & 63];
+                aOutput += 4;
+            }
+
+            const uint32_t remaining = aInputLength - i;
+            if(remaining > 0) {
+                const uint32_t group = (static_cast<uint32_t>(aInput[i]) << 16) | (remaining == 2 ? static_cast<uint32_t>(aInput[i + 1]) << 8 : 0);
+                *aOutput++ = aBase64[group >> 18];
+                *aOutput++ = aBase64[(group >> 12) & 63];
+                if(remaining == 2) *aOutput++ = aBase64[(group >> 6) & 63];
+                if(aPadding) {
+                    *aOutput++ = *aPadding;
+                    if(remaining == 1) *aOutput++ = *aPadding;
+                }
+            }
+
+            return aOutput;
+        }
+
+#if SOLAIRE_RUNTIME_DISPATCH
+        /*!
+            \brief Base64 encode 12 bytes into 16 characters (Mula and Lemire).
+            \details The alphabet is looked up as four 16 character tables so that any alphabet can be used.
+        */
+        SOLAIRE_TARGET("ssse3")
+        static char* Base64EncodeSsse3(char* aOutput, const uint8_t* const aInput, const uint32_t aInputLength, const char* const aBase64, const char* const aPadding) {
+            const __m128i tables[4] = {
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(aBase64)),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(aBase64 + 16)),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(aBase64 + 32)),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(aBase64 + 48))
+            };
+            const __m128i spread = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+            const __m128i select = _mm_set1_epi8(0x30);
+
+            uint32_t i = 0;
+            // 16 bytes are loaded for every 12 that are used
+            for(; i + 16 <= aInputLength; i += 12) {
+                const __m128i block = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(aInput + i)), spread);
+
+                // Move each 6 bit field into its own byte
+                const __m128i high = _mm_mulhi_epu16(_mm_and_si128(block, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+                const __m128i low = _mm_mullo_epi16(_mm_and_si128(block, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+                const __m128i indices = _mm_or_si128(high, low);
+
+                const __m128i quarter = _mm_and_si128(indices, select);
+                __m128i chars = _mm_and_si128(_mm_cmpeq_epi8(quarter, _mm_setzero_si128()), _mm_shuffle_epi8(tables[0], indices));
+                chars = _mm_or_si128(chars, _mm_and_si128(_mm_cmpeq_epi8(quarter, _mm_set1_epi8(0x10)), _mm_shuffle_epi8(tables[1], indices)));
+                chars = _mm_or_si128(chars, _mm_and_si128(_mm_cmpeq_epi8(quarter, _mm_set1_epi8(0x20)), _mm_shuffle_epi8(tables[2], indices)));
+                chars = _mm_or_si128(chars, _mm_and_si128(_mm_cmpeq_epi8(quarter, select), _mm_shuffle_epi8(tables[3], indices)));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(aOutput), chars);
+                aOutput += 16;
+            }
+
+            return Base64EncodeScalar(aOutput, aInput + i, aInputLength - i, aBase64, aPadding);
+        }
+#endif
+
+        static char* Base64DecodeScalar(char* aOutput, const char* const aInput, const uint32_t aInputLength, const char* const aBase64) {
+            // Characters that are not in the alphabet decode as 0
+            uint8_t table[256];
+            std::memset(table, 0, sizeof(table));
+            for(uint32_t i = 0; i < 64; ++i) table[static_cast<uint8_t>(aBase64[i])] = static_cast<uint8_t>(i);
+
+            const uint8_t* const input = reinterpret_cast<const uint8_t*>(aInput);
+            for(uint32_t i = 0; i + 4 <= aInputLength; i += 4) {
+                const uint32_t group =
+                    (static_cast<uint32_t>(table[input[i]]) << 18) |
+                    (static_cast<uint32_t>(table[input[i + 1]]) << 12) |
+                    (static_cast<uint32_t>(table[input[i + 2]]) << 6) |
+                    static_cast<uint32_t>(table[input[i + 3]]);
+                aOutput[0] = static_cast<char>(group >> 16);
+                aOutput[1] = static_cast<char>(group >> 8);
+                aOutput[2] = static_cast<char>(group);
+                aOutput += 3;
+            }
+            return aOutput;
+        }
+
+        // Crc32C
+
+        static uint32_t Crc32CSoftware(const uint32_t aRemainder, const void* const aValue, const size_t aBytes) {
+            return Crc32C::UpdateRemainderTable(aRemainder, aValue, aBytes);
+        }
+
+        static uint32_t Crc32CHardware(const uint32_t aRemainder, const void* const aValue, const size_t aBytes) {
+            return Crc32C::UpdateRemainderHardware(aRemainder, aValue, aBytes);
+        }
+
+        static uint32_t InitialiseFeatures() throw() {
+            uint32_t features = detectCpuFeatures();
+            const char* const limit = std::getenv("SOLAIRE_CPU_FEATURES");
+            if(limit) features &= parseCpuFeatures(limit);
+            return features;
+        }
+    }
+
+    uint32_t detectCpuFeatures() throw() {
+#if SOLAIRE_RUNTIME_DISPATCH
+        using namespace CpuDispatchImplementation;
+
+        enum : uint64_t {
+            XCR0_AVX = 0x06,        //!< SSE and AVX register state
+            XCR0_AVX512 = 0xE6      //!< SSE, AVX, opmask and ZMM register state
+        };
+
+        uint32_t registers[4];
+        Cpuid(0, 0, registers);
+        const uint32_t maxLeaf = registers[0];
+        if(maxLeaf < 1) return 0;
+
+        Cpuid(1, 0, registers);
+        const uint32_t ecx1 = registers[2];
+        const uint32_t edx1 = registers[3];
+
+        uint32_t features = 0;
+        if(edx1 & (1u << 26)) features |= CPU_SSE2;
+        if(ecx1 & (1u << 9)) features |= CPU_SSSE3;
+        if(ecx1 & (1u << 20)) features |= CPU_SSE4_2;
+        if(ecx1 & (1u << 1)) features |= CPU_PCLMUL;
+        if(ecx1 & (1u << 23)) features |= CPU_POPCNT;
+
+        const uint64_t xcr0 = (ecx1 & (1u << 27)) ? ReadXcr0() : 0;
+        const bool avx = (ecx1 & (1u << 28)) && (xcr0 & XCR0_AVX) == XCR0_AVX;
+        const bool avx512 = avx && (xcr0 & XCR0_AVX512) == XCR0_AVX512;
+
+        if(maxLeaf >= 7) {
+            Cpuid(7, 0, registers);
+            const uint32_t ebx7 = registers[1];
+            if(avx && (ebx7 & (1u << 5))) features |= CPU_AVX2;
+            if(ebx7 & (1u << 8)) features |= CPU_BMI2;
+            if(avx512 && (ebx7 & (1u << 16))) features |= CPU_AVX512F;
+            if(avx512 && (ebx7 & (1u << 30))) features |= CPU_AVX512BW;
+            if(ebx7 & (1u << 29)) features |= CPU_SHA;
+        }
+
+        return features;
+#else
+        return 0;
+#endif
+    }
+
+    uint32_t getCpuFeatures() throw() {
+        static const uint32_t FEATURES = CpuDispatchImplementation::InitialiseFeatures();
+        return FEATURES;
+    }
+
+    const char* getCpuFeatureName(const uint32_t aFeature) throw() {
+        for(uint32_t i = 0; i < CPU_FEATURE_COUNT; ++i) {
+            if(aFeature == (1u << i)) return CpuDispatchImplementation::FEATURE_NAMES[i];
+        }
+        return nullptr;
+    }
+
+    uint32_t parseCpuFeatures(const char* const aNames) throw() {
+        uint32_t features = 0;
+        const char* name = aNames;
+        while(*name != '\0') {
+            const char* end = name;
+            while(*end != '\0' && *end != ',' && *end != ' ') ++end;
+
+            const size_t length = static_cast<size_t>(end - name);
+            for(uint32_t i = 0; i < CPU_FEATURE_COUNT; ++i) {
+                const char* const feature = CpuDispatchImplementation::FEATURE_NAMES[i];
+                if(std::strlen(feature) == length && std::strncmp(feature, name, length) == 0) features |= 1u << i;
+            }
+
+            name = *end == '\0' ? end : end + 1;
+        }
+        return features;
+    }
+
+    MathsKernels selectMathsKernels(const uint32_t aFeatures) throw() {
+        using namespace CpuDispatchImplementation;
+
+        MathsKernels kernels = {
+            &PopCountScalar,
+            &ReflectScalar,
+            &BinaryToHexScalar,
+            &HexToBinaryScalar,
+            &Base64EncodeScalar,
+            &Base64DecodeScalar,
+            &Crc32CSoftware,
+            { "scalar", "scalar", "scalar", "scalar", "scalar", "scalar", "table" }
+        };
+
+#if SOLAIRE_RUNTIME_DISPATCH
+        if(aFeatures & CPU_POPCNT) {
+            kernels.popCount = &PopCountPopcnt;
+            kernels.names[0] = "popcnt";
+        }
+        if(aFeatures & CPU_AVX2) {
+            kernels.popCount = &PopCountAvx2;
+            kernels.names[0] = "avx2";
+        }
+
+        if(aFeatures & CPU_SSSE3) {
+            kernels.reflect = &ReflectSsse3;
+            kernels.binaryToHex = &BinaryToHexSsse3;
+            kernels.hexToBinary = &HexToBinarySsse3;
+            kernels.base64Encode = &Base64EncodeSsse3;
+            kernels.names[1] = "ssse3";
+            kernels.names[2] = "ssse3";
+            kernels.names[3] = "ssse3";
+            kernels.names[4] = "ssse3";
+        }
+        if((aFeatures & (CPU_SSSE3 | CPU_AVX2)) == (CPU_SSSE3 | CPU_AVX2)) {
+            kernels.reflect = &ReflectAvx2;
+            kernels.binaryToHex = &BinaryToHexAvx2;
+            kernels.names[1] = "avx2";
+            kernels.names[2] = "avx2";
+        }
+
+        if(aFeatures & CPU_SSE4_2) {
+            kernels.crc32c = &Crc32CHardware;
+            kernels.names[6] = "sse4.2";
+        }
+#endif
+
+        return kernels;
+    }
+
+    const MathsKernels& getMathsKernels() throw() {
+        static const MathsKernels KERNELS = selectMathsKernels(getCpuFeatures());
+        return KERNELS;
+    }
+}
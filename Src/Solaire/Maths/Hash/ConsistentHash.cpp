@@ -0,0 +1,240 @@
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+#include <algorithm>
+#include <cmath>
+#include "Solaire\Maths\Hash\ConsistentHash.hpp"
+
+namespace Solaire{
+
+    // Jump consistent hash
+
+    uint32_t JumpConsistentHash(uint64_t aKey, const uint32_t aBuckets) throw() {
+        int64_t bucket = -1;
+        int64_t next = 0;
+        while(next < static_cast<int64_t>(aBuckets)) {
+            bucket = next;
+            aKey = aKey * 2862933555777941757ULL + 1;
+            next = static_cast<int64_t>(static_cast<double>(bucket + 1) * (static_cast<double>(1LL << 31) / static_cast<double>((aKey >> 33) + 1)));
+        }
+        return bucket < 0 ? 0 : static_cast<uint32_t>(bucket);
+    }
+
+    void JumpConsistentHashBatch(const uint64_t* const aKeys, const size_t aCount, const uint32_t aBuckets, uint32_t* const aResults) throw() {
+        enum : size_t {
+            LANES = 4
+        };
+
+        size_t i = 0;
+        for(; i + LANES <= aCount; i += LANES) {
+            uint64_t keys[LANES];
+            int64_t buckets[LANES];
+            int64_t next[LANES];
+            for(size_t j = 0; j < LANES; ++j) {
+                keys[j] = aKeys[i + j];
+                buckets[j] = 0;
+                next[j] = 0;
+            }
+
+            // Lanes that have finished keep their bucket, the loop runs until the slowest lane is done
+            bool active = aBuckets > 0;
+            while(active) {
+                active = false;
+                for(size_t j = 0; j < LANES; ++j) {
+                    if(next[j] >= static_cast<int64_t>(aBuckets)) continue;
+                    buckets[j] = next[j];
+                    keys[j] = keys[j] * 2862933555777941757ULL + 1;
+                    next[j] = static_cast<int64_t>(static_cast<double>(buckets[j] + 1) * (static_cast<double>(1LL << 31) / static_cast<double>((keys[j] >> 33) + 1)));
+                    active |= next[j] < static_cast<int64_t>(aBuckets);
+                }
+            }
+
+            for(size_t j = 0; j < LANES; ++j) aResults[i + j] = static_cast<uint32_t>(buckets[j]);
+        }
+
+        for(; i < aCount; ++i) aResults[i] = JumpConsistentHash(aKeys[i], aBuckets);
+    }
+
+    // RendezvousHash
+
+    static inline uint64_t Mix(uint64_t aValue) throw() {
+        // SplitMix64 finaliser, every input bit affects every output bit
+        aValue = (aValue ^ (aValue >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        aValue = (aValue ^ (aValue >> 27)) * 0x94D049BB133111EBULL;
+        return aValue ^ (aValue >> 31);
+    }
+
+    static inline uint64_t RawScore(const uint64_t aKey, const uint64_t aId) throw() {
+        // 53 bits so that raw and weighted scores order nodes the same way
+        return Mix(aKey ^ Mix(aId)) >> 11;
+    }
+
+    static inline double WeightedScore(const uint64_t aRawScore, const double aWeight) throw() {
+        // u is in (0, 1) so -ln(u) is never 0
+        const double u = (static_cast<double>(aRawScore) + 0.5) * (1.0 / 9007199254740992.0);
+        return aWeight / -std::log(u);
+    }
+
+    /*!
+        \brief Select a node for every key, visiting the nodes in the outer loop over blocks of keys.
+        \param aScore Returns the score of a key for the node with a mixed id and index.
+    */
+    template<class SCORE>
+    static void SelectBlocks(const uint64_t* const aKeys, const size_t aCount, const std::vector<uint64_t>& aIds, uint32_t* const aResults, const SCORE& aScore) throw() {
+        enum : size_t {
+            BLOCK = 64
+        };
+        typedef decltype(aScore(uint64_t(), uint64_t(), uint32_t())) ScoreType;
+
+        const uint32_t size = static_cast<uint32_t>(aIds.size());
+        ScoreType scores[BLOCK];
+        for(size_t begin = 0; begin < aCount; begin += BLOCK) {
+            const size_t count = std::min<size_t>(aCount - begin, BLOCK);
+            const uint64_t first = Mix(aIds[0]);
+            for(size_t i = 0; i < count; ++i) {
+                scores[i] = aScore(aKeys[begin + i], first, 0);
+                aResults[begin + i] = 0;
+            }
+
+            for(uint32_t node = 1; node < size; ++node) {
+                const uint64_t id = Mix(aIds[node]);
+                for(size_t i = 0; i < count; ++i) {
+                    const ScoreType score = aScore(aKeys[begin + i], id, node);
+                    const uint32_t best = aResults[begin + i];
+                    if(score > scores[i] || (score == scores[i] && aIds[node] < aIds[best])) {
+                        scores[i] = score;
+                        aResults[begin + i] = node;
+                    }
+                }
+            }
+        }
+    }
+
+    RendezvousHash::RendezvousHash() :
+        mUniform(true)
+    {}
+
+    void RendezvousHash::UpdateUniform() throw() {
+        mUniform = true;
+        for(const double weight : mWeights) {
+            if(weight != mWeights[0]) mUniform = false;
+        }
+    }
+
+    double RendezvousHash::Score(const uint64_t aKey, const uint32_t aNode) const throw() {
+        return WeightedScore(RawScore(aKey, mIds[aNode]), mWeights[aNode]);
+    }
+
+    uint32_t RendezvousHash::AddNode(const uint64_t aId, const double aWeight) {
+        const std::vector<uint64_t>::const_iterator existing = std::find(mIds.begin(), mIds.end(), aId);
+        const uint32_t index = static_cast<uint32_t>(existing - mIds.begin());
+        if(existing == mIds.end()) {
+            mIds.push_back(aId);
+            mWeights.push_back(aWeight);
+        }else {
+            mWeights[index] = aWeight;
+        }
+        UpdateUniform();
+        return index;
+    }
+
+    bool RendezvousHash::RemoveNode(const uint64_t aId) throw() {
+        const std::vector<uint64_t>::iterator existing = std::find(mIds.begin(), mIds.end(), aId);
+        if(existing == mIds.end()) return false;
+
+        const size_t index = static_cast<size_t>(existing - mIds.begin());
+        mIds[index] = mIds.back();
+        mWeights[index] = mWeights.back();
+        mIds.pop_back();
+        mWeights.pop_back();
+        UpdateUniform();
+        return true;
+    }
+
+    uint32_t RendezvousHash::Size() const throw() {
+        return static_cast<uint32_t>(mIds.size());
+    }
+
+    uint64_t RendezvousHash::NodeId(const uint32_t aIndex) const throw() {
+        return mIds[aIndex];
+    }
+
+    double RendezvousHash::NodeWeight(const uint32_t aIndex) const throw() {
+        return mWeights[aIndex];
+    }
+
+    uint32_t RendezvousHash::Select(const uint64_t aKey) const throw() {
+        const uint32_t size = Size();
+        if(size == 0) return NO_NODE;
+
+        uint32_t best = 0;
+        if(mUniform) {
+            uint64_t bestScore = RawScore(aKey, mIds[0]);
+            for(uint32_t i = 1; i < size; ++i) {
+                const uint64_t score = RawScore(aKey, mIds[i]);
+                if(score > bestScore || (score == bestScore && mIds[i] < mIds[best])) {
+                    bestScore = score;
+                    best = i;
+                }
+            }
+        }else {
+            double bestScore = Score(aKey, 0);
+            for(uint32_t i = 1; i < size; ++i) {
+                const double score = Score(aKey, i);
+                if(score > bestScore || (score == bestScore && mIds[i] < mIds[best])) {
+                    bestScore = score;
+                    best = i;
+                }
+            }
+        }
+        return best;
+    }
+
+    uint32_t RendezvousHash::SelectReplicas(const uint64_t aKey, const uint32_t aCount, uint32_t* const aNodes) const {
+        const uint32_t size = Size();
+        std::vector<std::pair<double, uint32_t>> scores(size);
+        for(uint32_t i = 0; i < size; ++i) {
+            scores[i].first = mUniform ? static_cast<double>(RawScore(aKey, mIds[i])) : Score(aKey, i);
+            scores[i].second = i;
+        }
+
+        const uint32_t count = std::min(aCount, size);
+        std::partial_sort(scores.begin(), scores.begin() + count, scores.end(),
+            [this](const std::pair<double, uint32_t>& aA, const std::pair<double, uint32_t>& aB) {
+                return aA.first > aB.first || (aA.first == aB.first && mIds[aA.second] < mIds[aB.second]);
+            }
+        );
+        for(uint32_t i = 0; i < count; ++i) aNodes[i] = scores[i].second;
+        return count;
+    }
+
+    void RendezvousHash::SelectBatch(const uint64_t* const aKeys, const size_t aCount, uint32_t* const aResults) const throw() {
+        if(Size() == 0) {
+            for(size_t i = 0; i < aCount; ++i) aResults[i] = NO_NODE;
+        }else if(mUniform) {
+            SelectBlocks(aKeys, aCount, mIds, aResults, [](const uint64_t aKey, const uint64_t aId, const uint32_t) {
+                return Mix(aKey ^ aId) >> 11;
+            });
+        }else {
+            const double* const weights = mWeights.data();
+            SelectBlocks(aKeys, aCount, mIds, aResults, [weights](const uint64_t aKey, const uint64_t aId, const uint32_t aNode) {
+                return WeightedScore(Mix(aKey ^ aId) >> 11, weights[aNode]);
+            });
+        }
+    }
+}
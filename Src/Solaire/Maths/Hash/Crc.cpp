@@ -16,8 +16,310 @@
 // Email             : solairelibrary@mail.com
 // GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
 
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
 #include "Solaire\Maths\Hash\Crc.hpp"
 
+#if SOLAIRE_RUNTIME_DISPATCH
+    #define SOLAIRE_CRC32C_HARDWARE 1
+    #include <immintrin.h>
+#else
+    #define SOLAIRE_CRC32C_HARDWARE 0
+#endif
+
 namespace Solaire{
 
+#if SOLAIRE_CRC32C_HARDWARE
+    namespace Crc32CImplementation {
+        enum : uint32_t{
+            POLYNOMIAL  = 0x82F63B78,   //!< Reflected form of 0x1EDC6F41
+            X0          = 0x80000000,   //!< x^0 in reflected form
+            LONG_BLOCK  = 8192,         //!< Bytes per stream when processing large blocks
+            SHORT_BLOCK = 256           //!< Bytes per stream when processing small blocks
+        };
+
+        static constexpr uint32_t MultiplyBits(const uint32_t aA, const uint32_t aB, const int32_t aBit) {
+            return aBit < 0 ? 0 :
+                (((aA >> aBit) & 1) ? aB : 0) ^
+                MultiplyBits(aA, (aB & 1) ? (aB >> 1) ^ POLYNOMIAL : aB >> 1, aBit - 1);
+        }
+
+        /*!
+            \brief Multiply two reflected polynomials modulo POLYNOMIAL.
+        */
+        static constexpr uint32_t Multiply(const uint32_t aA, const uint32_t aB) {
+            return MultiplyBits(aA, aB, 31);
+        }
+
+        static constexpr uint32_t Square(const uint32_t aA) {
+            return Multiply(aA, aA);
+        }
+
+        /*!
+            \brief Calculate x^aPower modulo POLYNOMIAL.
+        */
+        static constexpr uint32_t XPower(const uint32_t aPower) {
+            return
+                aPower == 0 ? X0 :
+                aPower & 1 ? Multiply(XPower(aPower - 1), X0 >> 1) :
+                Square(XPower(aPower / 2));
+        }
+
+        template<const uint32_t BYTES, class SEQUENCE>
+        struct ShiftTable;
+
+        /*!
+            \brief Tables that advance a remainder past BYTES zero bytes, one table for each byte of the remainder.
+        */
+        template<const uint32_t BYTES, size_t... INDICES>
+        struct ShiftTable<BYTES, std::index_sequence<INDICES...>> {
+            static constexpr uint32_t VALUES[sizeof...(INDICES)] = {
+                Multiply(XPower(8 * BYTES), static_cast<uint32_t>(INDICES % 256) << (8 * (INDICES / 256)))...
+            };
+
+            static uint32_t Shift(const uint32_t aRemainder) throw() {
+                return
+                    VALUES[aRemainder & 0xFF] ^
+                    VALUES[256 + ((aRemainder >> 8) & 0xFF)] ^
+                    VALUES[512 + ((aRemainder >> 16) & 0xFF)] ^
+                    VALUES[768 + (aRemainder >> 24)];
+            }
+        };
+
+        template<const uint32_t BYTES, size_t... INDICES>
+        constexpr uint32_t ShiftTable<BYTES, std::index_sequence<INDICES...>>::VALUES[sizeof...(INDICES)];
+
+        static inline uint64_t Read64(const uint8_t* const aData) throw() {
+            uint64_t tmp;
+            std::memcpy(&tmp, aData, sizeof(uint64_t));
+            return tmp;
+        }
+
+        template<const uint32_t BYTES>
+        SOLAIRE_TARGET("sse4.2")
+        static const uint8_t* UpdateStreams(uint64_t& aRemainder, const uint8_t* aData, size_t& aBytes) throw() {
+            typedef ShiftTable<BYTES, std::make_index_sequence<1024>> Table;
+
+            while(aBytes >= BYTES * 3) {
+                uint64_t crc0 = aRemainder;
+                uint64_t crc1 = 0;
+                uint64_t crc2 = 0;
+                const uint8_t* const end = aData + BYTES;
+                do{
+                    crc0 = _mm_crc32_u64(crc0, Read64(aData));
+                    crc1 = _mm_crc32_u64(crc1, Read64(aData + BYTES));
+                    crc2 = _mm_crc32_u64(crc2, Read64(aData + BYTES * 2));
+                    aData += sizeof(uint64_t);
+                }while(aData != end);
+
+                // Merge the streams by moving each remainder past the bytes of the streams that follow it
+                crc0 = Table::Shift(static_cast<uint32_t>(crc0)) ^ crc1;
+                aRemainder = Table::Shift(static_cast<uint32_t>(crc0)) ^ crc2;
+                aData += BYTES * 2;
+                aBytes -= BYTES * 3;
+            }
+
+            return aData;
+        }
+    }
+#endif
+
+    namespace CrcImplementation {
+
+        /*!
+            \brief Threads that wait for ParallelFor jobs, one job runs at a time.
+        */
+        class ThreadPool {
+        private:
+            std::mutex mCallerLock;
+            std::mutex mLock;
+            std::condition_variable mWake;
+            std::condition_variable mFinished;
+            std::vector<std::thread> mWorkers;
+            void(*mTask)(void*, size_t);
+            void* mContext;
+            size_t mCount;
+            std::atomic<size_t> mNext;
+            uint64_t mGeneration;
+            size_t mActive;
+            bool mStop;
+        private:
+            void RunTasks(void(* const aTask)(void*, size_t), void* const aContext, const size_t aCount) throw() {
+                for(size_t i = mNext.fetch_add(1); i < aCount; i = mNext.fetch_add(1)) aTask(aContext, i);
+            }
+
+            void Work() throw() {
+                std::unique_lock<std::mutex> lock(mLock);
+                uint64_t generation = mGeneration;
+                while(true) {
+                    mWake.wait(lock, [&](){return mStop || mGeneration != generation;});
+                    if(mStop) return;
+                    generation = mGeneration;
+
+                    // A job cannot be replaced while a thread is active in it
+                    ++mActive;
+                    void(* const task)(void*, size_t) = mTask;
+                    void* const context = mContext;
+                    const size_t count = mCount;
+                    lock.unlock();
+                    RunTasks(task, context, count);
+                    lock.lock();
+                    if(--mActive == 0) mFinished.notify_all();
+                }
+            }
+
+            void Grow(const size_t aWorkers) throw() {
+                while(mWorkers.size() < aWorkers) {
+                    try{
+                        mWorkers.emplace_back(&ThreadPool::Work, this);
+                    }catch(...) {
+                        return;
+                    }
+                }
+            }
+        public:
+            ThreadPool() throw() :
+                mTask(nullptr),
+                mContext(nullptr),
+                mCount(0),
+                mNext(0),
+                mGeneration(0),
+                mActive(0),
+                mStop(false)
+            {}
+
+            ~ThreadPool() throw() {
+                {
+                    std::lock_guard<std::mutex> lock(mLock);
+                    mStop = true;
+                }
+                mWake.notify_all();
+                for(std::thread& worker : mWorkers) worker.join();
+            }
+
+            void Run(const size_t aCount, const size_t aWorkers, void(* const aTask)(void*, size_t), void* const aContext) throw() {
+                std::unique_lock<std::mutex> caller(mCallerLock, std::try_to_lock);
+                if(! caller.owns_lock()) {
+                    for(size_t i = 0; i < aCount; ++i) aTask(aContext, i);
+                    return;
+                }
+
+                Grow(aWorkers);
+
+                std::unique_lock<std::mutex> lock(mLock);
+                mFinished.wait(lock, [&](){return mActive == 0;});
+                mTask = aTask;
+                mContext = aContext;
+                mCount = aCount;
+                mNext = 0;
+                ++mGeneration;
+                lock.unlock();
+                mWake.notify_all();
+
+                RunTasks(aTask, aContext, aCount);
+
+                lock.lock();
+                mFinished.wait(lock, [&](){return mActive == 0;});
+            }
+        };
+
+        void ParallelFor(const size_t aCount, const uint32_t aThreads, void(*aTask)(void*, size_t), void* const aContext) throw() {
+            static ThreadPool POOL;
+
+            size_t workers = aThreads > 1 ? aThreads - 1 : 0;
+            const size_t cores = std::thread::hardware_concurrency();
+            if(cores > 0 && workers > cores - 1) workers = cores - 1;
+
+            if(aCount <= 1 || workers == 0) {
+                for(size_t i = 0; i < aCount; ++i) aTask(aContext, i);
+            }else {
+                POOL.Run(aCount, workers, aTask, aContext);
+            }
+        }
+    }
+
+    // Crc32C::State
+
+    Crc32C::State::State() throw() :
+        mRemainder(Crc32CTable::InitialRemainder())
+    {}
+
+    SOLAIRE_EXPORT_CALL Crc32C::State::~State() throw() {
+
+    }
+
+    void SOLAIRE_EXPORT_CALL Crc32C::State::Initialise() throw() {
+        mRemainder = Crc32CTable::InitialRemainder();
+    }
+
+    void SOLAIRE_EXPORT_CALL Crc32C::State::Update(const void* const aValue, const size_t aBytes) throw() {
+        mRemainder = UpdateRemainder(mRemainder, aValue, aBytes);
+    }
+
+    Crc32C::HashType SOLAIRE_EXPORT_CALL Crc32C::State::Finalise() const throw() {
+        return Crc32CTable::FinalRemainder(mRemainder);
+    }
+
+    // Crc32C
+
+    Crc32C::HashType Crc32C::UpdateRemainder(const HashType aRemainder, const void* const aValue, const size_t aBytes) throw() {
+        return getMathsKernels().crc32c(aRemainder, aValue, aBytes);
+    }
+
+    Crc32C::HashType Crc32C::UpdateRemainderTable(const HashType aRemainder, const void* const aValue, const size_t aBytes) throw() {
+        return Crc32CTable::UpdateRemainder(aRemainder, aValue, aBytes);
+    }
+
+    SOLAIRE_TARGET("sse4.2")
+    Crc32C::HashType Crc32C::UpdateRemainderHardware(const HashType aRemainder, const void* const aValue, const size_t aBytes) throw() {
+#if SOLAIRE_CRC32C_HARDWARE
+        using namespace Crc32CImplementation;
+
+        const uint8_t* data = static_cast<const uint8_t*>(aValue);
+        size_t bytes = aBytes;
+        uint64_t remainder = aRemainder;
+
+        // Align the data for the 8 byte instruction
+        while(bytes > 0 && (reinterpret_cast<uintptr_t>(data) & 7) != 0) {
+            remainder = _mm_crc32_u8(static_cast<uint32_t>(remainder), *data);
+            ++data;
+            --bytes;
+        }
+
+        data = UpdateStreams<LONG_BLOCK>(remainder, data, bytes);
+        data = UpdateStreams<SHORT_BLOCK>(remainder, data, bytes);
+
+        while(bytes >= sizeof(uint64_t)) {
+            remainder = _mm_crc32_u64(remainder, Read64(data));
+            data += sizeof(uint64_t);
+            bytes -= sizeof(uint64_t);
+        }
+
+        while(bytes > 0) {
+            remainder = _mm_crc32_u8(static_cast<uint32_t>(remainder), *data);
+            ++data;
+            --bytes;
+        }
+
+        return static_cast<HashType>(remainder);
+#else
+        return Crc32CTable::UpdateRemainder(aRemainder, aValue, aBytes);
+#endif
+    }
+
+    Crc32C::HashType Crc32C::Combine(const HashType aCrcA, const HashType aCrcB, const uint64_t aBytesB) throw() {
+        return Crc32CTable::Combine(aCrcA, aCrcB, aBytesB);
+    }
+
+    Crc32C::HashType Crc32C::Hash(const void* const aValue, const size_t aBytes, const uint32_t aThreads) const throw() {
+        return CrcImplementation::HashParallel<HashType>(aValue, aBytes, aThreads, &Policy::Hash, &Combine);
+    }
+
+    Crc32C::HashType SOLAIRE_EXPORT_CALL Crc32C::Hash(const void* const aValue, const size_t aBytes) const throw() {
+        return Policy::Hash(aValue, aBytes);
+    }
 }
@@ -17,17 +17,63 @@
 // GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
 
 #include "Solaire\Maths\Hash\Djb2.hpp"
+#include "Solaire\Maths\Hash\HashBatch.hpp"
 
 namespace Solaire{
 
+    namespace Djb2Implementation {
+        struct Lanes {
+            enum : uint32_t{
+                INITIAL_HASH = Djb2::Policy::INITIAL_HASH
+            };
+
+            static inline uint32_t Update(const uint32_t aHash, const void* const aValue, const size_t aBytes) throw() {
+                return Djb2::Policy::Update(aHash, aValue, aBytes);
+            }
+
+#if SOLAIRE_HASH_BATCH_SSE2
+            static inline __m128i Step(const __m128i aHash, const __m128i aByte) throw() {
+                return _mm_add_epi32(_mm_add_epi32(_mm_slli_epi32(aHash, 5), aHash), aByte);
+            }
+#endif
+
+#if SOLAIRE_HASH_BATCH_AVX2
+            static inline __m256i Step(const __m256i aHash, const __m256i aByte) throw() {
+                return _mm256_add_epi32(_mm256_add_epi32(_mm256_slli_epi32(aHash, 5), aHash), aByte);
+            }
+#endif
+        };
+    }
+
+    // Djb2::State
+
+    Djb2::State::State() throw() :
+        mHash(Policy::INITIAL_HASH)
+    {}
+
+    SOLAIRE_EXPORT_CALL Djb2::State::~State() throw() {
+
+    }
+
+    void SOLAIRE_EXPORT_CALL Djb2::State::Initialise() throw() {
+        mHash = Policy::INITIAL_HASH;
+    }
+
+    void SOLAIRE_EXPORT_CALL Djb2::State::Update(const void* const aValue, const size_t aBytes) throw() {
+        mHash = Policy::Update(mHash, aValue, aBytes);
+    }
+
+    Djb2::HashType SOLAIRE_EXPORT_CALL Djb2::State::Finalise() const throw() {
+        return mHash;
+    }
+
     // Djb2
 
 	Djb2::HashType SOLAIRE_EXPORT_CALL Djb2::Hash(const void* const aValue, const size_t aBytes) const throw() {
-		HashType hash = 5381;
-		const uint8_t* const data = static_cast<const uint8_t*>(aValue);
-		for (size_t i = 0; i < aBytes; ++i){
-			hash = (hash << 5) + hash + data[i];
-		}
-		return hash;
+        return Policy::Hash(aValue, aBytes);
+    }
+
+	void SOLAIRE_EXPORT_CALL Djb2::HashBatch(const void* const* const aKeys, const size_t* const aLengths, HashType* const aHashes, const size_t aCount) const throw() {
+        HashBatchImplementation::HashBatch<Djb2Implementation::Lanes>(aKeys, aLengths, aHashes, aCount);
     }
 }
@@ -0,0 +1,178 @@
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+#include <utility>
+#include "Solaire\Maths\Hash\FastCdc.hpp"
+
+namespace Solaire{
+
+    namespace FastCdcImplementation {
+        enum : uint32_t {
+            MASK_LOWEST_BIT = 16,   //!< Mask bits are spread over [16, 63) so that each depends on at least 17 bytes
+            MASK_HIGHEST_BIT = 62,  //!< Bit 63 is left clear so that a mask can be shifted left by one
+            READ_BLOCK = 4096
+        };
+
+        static constexpr uint64_t XorShiftMultiply(const uint64_t aValue, const uint32_t aShift, const uint64_t aMultiplier) {
+            return (aValue ^ (aValue >> aShift)) * aMultiplier;
+        }
+
+        /*!
+            \brief The aIndex'th output of SplitMix64 with a seed of 0.
+        */
+        static constexpr uint64_t SplitMix64(const uint64_t aIndex) {
+            return XorShiftMultiply(XorShiftMultiply(XorShiftMultiply((aIndex + 1) * 0x9E3779B97F4A7C15ULL, 30, 0xBF58476D1CE4E5B9ULL), 27, 0x94D049BB133111EBULL), 31, 1);
+        }
+
+        template<class SEQUENCE>
+        struct GearTable;
+
+        /*!
+            \brief Random values for the Gear hash, VALUES[256 + i] is VALUES[i] << 1 for consuming two bytes per step.
+        */
+        template<size_t... INDICES>
+        struct GearTable<std::index_sequence<INDICES...>> {
+            static constexpr uint64_t VALUES[sizeof...(INDICES)] = {
+                (SplitMix64(INDICES % 256) << (INDICES / 256))...
+            };
+        };
+
+        template<size_t... INDICES>
+        constexpr uint64_t GearTable<std::index_sequence<INDICES...>>::VALUES[sizeof...(INDICES)];
+
+        typedef GearTable<std::make_index_sequence<512>> Gear;
+
+        /*!
+            \brief A mask with aBits bits spread evenly over [MASK_LOWEST_BIT, MASK_HIGHEST_BIT].
+        */
+        static uint64_t SpreadMask(const uint32_t aBits) throw() {
+            enum : uint32_t {
+                RANGE = MASK_HIGHEST_BIT - MASK_LOWEST_BIT + 1
+            };
+
+            uint64_t mask = 0;
+            for(uint32_t i = 0; i < aBits; ++i) mask |= 1ULL << (MASK_HIGHEST_BIT - (i * RANGE) / aBits);
+            return mask;
+        }
+
+        /*!
+            \brief Advance the Gear hash over [aBegin, aEnd) until the hash has no bits under aMask.
+            \return The position after the byte that completed the match, or aEnd.
+        */
+        static inline size_t Scan(const uint8_t* const aData, size_t aBegin, const size_t aEnd, uint64_t& aHash, const uint64_t aMask) throw() {
+            const uint64_t* const gear = Gear::VALUES;
+            const uint64_t* const gearShifted = Gear::VALUES + 256;
+            const uint64_t maskShifted = aMask << 1;
+            uint64_t hash = aHash;
+
+            // (((h << 1) + G[a]) << 1) + G[b] == (h << 2) + (G[a] << 1) + G[b], and testing the intermediate value
+            // shifted left by one against the shifted mask is the same as testing the intermediate value
+            while(aBegin + 2 <= aEnd) {
+                hash = (hash << 2) + gearShifted[aData[aBegin]];
+                if((hash & maskShifted) == 0) {
+                    aHash = hash >> 1;
+                    return aBegin + 1;
+                }
+                hash += gear[aData[aBegin + 1]];
+                if((hash & aMask) == 0) {
+                    aHash = hash;
+                    return aBegin + 2;
+                }
+                aBegin += 2;
+            }
+
+            if(aBegin < aEnd) {
+                hash = (hash << 1) + gear[aData[aBegin]];
+                ++aBegin;
+                if((hash & aMask) == 0) {
+                    aHash = hash;
+                    return aBegin;
+                }
+            }
+
+            aHash = hash;
+            return aEnd;
+        }
+    }
+
+    // FastCdc
+
+    FastCdc::FastCdc(const uint32_t aMinimum, const uint32_t aAverage, const uint32_t aMaximum, const uint32_t aNormalisation) throw() {
+        const uint32_t average = std::min<uint32_t>(std::max<uint32_t>(aAverage, SMALLEST_CHUNK), LARGEST_CHUNK);
+        uint32_t bits = 0;
+        while((2u << bits) <= average) ++bits;
+        // Round to the nearer power of two
+        if(bits < 30 && average - (1u << bits) > (2u << bits) - average) ++bits;
+
+        mAverage = 1u << bits;
+        mMinimum = std::min<uint32_t>(std::max<uint32_t>(aMinimum, SMALLEST_CHUNK), mAverage);
+        mMaximum = std::max<uint32_t>(std::min<uint32_t>(aMaximum, LARGEST_CHUNK), mAverage);
+
+        const uint32_t normalisation = std::min<uint32_t>(aNormalisation, 3);
+        mMaskSmall = FastCdcImplementation::SpreadMask(bits + normalisation);
+        mMaskLarge = FastCdcImplementation::SpreadMask(bits > normalisation ? bits - normalisation : 1);
+    }
+
+    uint32_t FastCdc::MinimumSize() const throw() {
+        return mMinimum;
+    }
+
+    uint32_t FastCdc::AverageSize() const throw() {
+        return mAverage;
+    }
+
+    uint32_t FastCdc::MaximumSize() const throw() {
+        return mMaximum;
+    }
+
+    size_t FastCdc::Cut(const void* const aData, const size_t aBytes) const throw() {
+        if(aBytes <= mMinimum) return aBytes;
+
+        const uint8_t* const data = static_cast<const uint8_t*>(aData);
+        const size_t end = std::min<size_t>(aBytes, mMaximum);
+        const size_t normal = std::min<size_t>(mAverage, end);
+        uint64_t hash = 0;
+
+        const size_t cut = FastCdcImplementation::Scan(data, mMinimum, normal, hash, mMaskSmall);
+        if(cut < normal) return cut;
+        return FastCdcImplementation::Scan(data, normal, end, hash, mMaskLarge);
+    }
+
+    size_t FastCdc::ReadStream(IStream& aStream, uint8_t* const aBuffer, const size_t aBytes) throw() {
+        size_t bytes = 0;
+
+        // The number of bytes a block read produced is only known from the offset
+        if(aStream.isOffsetable()) {
+            while(bytes < aBytes && ! aStream.end()) {
+                const uint32_t count = static_cast<uint32_t>(std::min<size_t>(aBytes - bytes, FastCdcImplementation::READ_BLOCK));
+                const uint32_t before = static_cast<uint32_t>(aStream.getOffset());
+                aStream.read(aBuffer + bytes, count);
+                const uint32_t read = static_cast<uint32_t>(aStream.getOffset()) - before;
+                bytes += std::min(read, count);
+                if(read == 0) break;
+            }
+        }else {
+            while(bytes < aBytes && ! aStream.end()) {
+                aStream.read(aBuffer + bytes, 1);
+                ++bytes;
+            }
+        }
+
+        return bytes;
+    }
+}
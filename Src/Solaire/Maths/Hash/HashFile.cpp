@@ -0,0 +1,180 @@
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+#include "Solaire\Maths\Hash\HashFile.hpp"
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace Solaire{
+
+    // MappedFile
+
+    MappedFile::MappedFile() throw() :
+        mData(nullptr),
+        mMappedBytes(0),
+        mSize(0),
+#if defined(_WIN32)
+        mFile(INVALID_HANDLE_VALUE),
+        mMapping(nullptr)
+#else
+        mFile(-1)
+#endif
+    {}
+
+    MappedFile::~MappedFile() throw() {
+        Close();
+    }
+
+    bool MappedFile::Open(const char* const aPath) throw() {
+        Close();
+#if defined(_WIN32)
+        mFile = CreateFileA(aPath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if(mFile == INVALID_HANDLE_VALUE) return false;
+
+        LARGE_INTEGER size;
+        if(! GetFileSizeEx(mFile, &size)) {
+            Close();
+            return false;
+        }
+        mSize = static_cast<uint64_t>(size.QuadPart);
+
+        // A mapping object cannot be created for an empty file
+        if(mSize > 0) {
+            mMapping = CreateFileMappingA(mFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if(mMapping == nullptr) {
+                Close();
+                return false;
+            }
+        }
+#else
+        mFile = open(aPath, O_RDONLY);
+        if(mFile < 0) return false;
+
+        struct stat status;
+        if(fstat(mFile, &status) != 0 || ! S_ISREG(status.st_mode)) {
+            Close();
+            return false;
+        }
+        mSize = static_cast<uint64_t>(status.st_size);
+
+    #if defined(POSIX_FADV_SEQUENTIAL)
+        posix_fadvise(mFile, 0, 0, POSIX_FADV_SEQUENTIAL);
+    #endif
+#endif
+        return true;
+    }
+
+    void MappedFile::Close() throw() {
+        Unmap();
+#if defined(_WIN32)
+        if(mMapping != nullptr) CloseHandle(mMapping);
+        if(mFile != INVALID_HANDLE_VALUE) CloseHandle(mFile);
+        mMapping = nullptr;
+        mFile = INVALID_HANDLE_VALUE;
+#else
+        if(mFile >= 0) close(mFile);
+        mFile = -1;
+#endif
+        mSize = 0;
+    }
+
+    bool MappedFile::IsOpen() const throw() {
+#if defined(_WIN32)
+        return mFile != INVALID_HANDLE_VALUE;
+#else
+        return mFile >= 0;
+#endif
+    }
+
+    uint64_t MappedFile::Size() const throw() {
+        return mSize;
+    }
+
+    const uint8_t* MappedFile::Map(const uint64_t aOffset, const size_t aBytes) throw() {
+        Unmap();
+        if(! IsOpen() || aBytes == 0 || aOffset + aBytes > mSize) return nullptr;
+
+#if defined(_WIN32)
+        void* const data = MapViewOfFile(mMapping, FILE_MAP_READ, static_cast<DWORD>(aOffset >> 32), static_cast<DWORD>(aOffset), aBytes);
+        if(data == nullptr) return nullptr;
+#else
+        void* const data = mmap(nullptr, aBytes, PROT_READ, MAP_PRIVATE, mFile, static_cast<off_t>(aOffset));
+        if(data == MAP_FAILED) return nullptr;
+
+        // Read ahead aggressively and drop pages behind the reader, then start reading the first stride
+        madvise(data, aBytes, MADV_SEQUENTIAL);
+    #if defined(MADV_HUGEPAGE)
+        madvise(data, aBytes, MADV_HUGEPAGE);
+    #endif
+        madvise(data, aBytes < STRIDE_BYTES ? aBytes : STRIDE_BYTES, MADV_WILLNEED);
+#endif
+
+        mData = static_cast<const uint8_t*>(data);
+        mMappedBytes = aBytes;
+        return mData;
+    }
+
+    void MappedFile::Unmap() throw() {
+        if(mData == nullptr) return;
+#if defined(_WIN32)
+        UnmapViewOfFile(mData);
+#else
+        munmap(const_cast<uint8_t*>(mData), mMappedBytes);
+#endif
+        mData = nullptr;
+        mMappedBytes = 0;
+    }
+
+    void MappedFile::Prefetch(const uint8_t* const aData, const size_t aBytes) const throw() {
+#if defined(_WIN32)
+        WIN32_MEMORY_RANGE_ENTRY range;
+        range.VirtualAddress = const_cast<uint8_t*>(aData);
+        range.NumberOfBytes = aBytes;
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else
+        // madvise needs a page aligned address
+        const uintptr_t mask = static_cast<uintptr_t>(Granularity()) - 1;
+        const uintptr_t begin = reinterpret_cast<uintptr_t>(aData) & ~mask;
+        madvise(reinterpret_cast<void*>(begin), aBytes + (reinterpret_cast<uintptr_t>(aData) - begin), MADV_WILLNEED);
+#endif
+    }
+
+    size_t MappedFile::Granularity() throw() {
+#if defined(_WIN32)
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return info.dwAllocationGranularity;
+#else
+        const long page = sysconf(_SC_PAGESIZE);
+        return page > 0 ? static_cast<size_t>(page) : 4096;
+#endif
+    }
+
+    size_t MappedFile::WindowBytes() throw() {
+        // A multiple of every page size and allocation granularity in use, small enough for 32 bit address spaces
+        return sizeof(void*) >= 8 ? static_cast<size_t>(1) << 30 : static_cast<size_t>(64) << 20;
+    }
+}
@@ -0,0 +1,207 @@
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+#include <cmath>
+#include <cstring>
+#include "Solaire\Maths\Hash\HyperLogLog.hpp"
+
+#if defined(__AVX2__)
+    #define SOLAIRE_HYPER_LOG_LOG_AVX2 1
+    #define SOLAIRE_HYPER_LOG_LOG_SSSE3 1
+    #include <immintrin.h>
+#elif defined(__SSSE3__) || (defined(_MSC_VER) && defined(__AVX__))
+    #define SOLAIRE_HYPER_LOG_LOG_AVX2 0
+    #define SOLAIRE_HYPER_LOG_LOG_SSSE3 1
+    #include <tmmintrin.h>
+#else
+    #define SOLAIRE_HYPER_LOG_LOG_AVX2 0
+    #define SOLAIRE_HYPER_LOG_LOG_SSSE3 0
+#endif
+
+namespace Solaire{ namespace HyperLogLogImplementation{
+
+    /*
+        Registers are compared 4 at a time in the low 24 bits of a 32 bit word. Every other register is masked out,
+        which leaves a spare bit above each remaining one. Subtracting with that bit set leaves it set only where the
+        first register is larger or equal, and it is then spread into a select mask for the register.
+    */
+    enum : uint32_t {
+        EVEN_REGISTERS = 0x03F03F,
+        GUARD_BITS = 0x040040
+    };
+
+    static inline uint32_t Read24(const uint8_t* const aData) throw() {
+        return aData[0] | (static_cast<uint32_t>(aData[1]) << 8) | (static_cast<uint32_t>(aData[2]) << 16);
+    }
+
+    static inline uint32_t MaxEven(const uint32_t aA, const uint32_t aB) throw() {
+        const uint32_t a = aA & EVEN_REGISTERS;
+        const uint32_t b = aB & EVEN_REGISTERS;
+        const uint32_t greater = ((a | GUARD_BITS) - b) & GUARD_BITS;
+        const uint32_t mask = greater - (greater >> 6);
+        return (a & mask) | (b & ~mask);
+    }
+
+#if SOLAIRE_HYPER_LOG_LOG_SSSE3
+    static inline __m128i MaxEven(const __m128i aA, const __m128i aB) throw() {
+        const __m128i registers = _mm_set1_epi32(EVEN_REGISTERS);
+        const __m128i guard = _mm_set1_epi32(GUARD_BITS);
+        const __m128i a = _mm_and_si128(aA, registers);
+        const __m128i b = _mm_and_si128(aB, registers);
+        const __m128i greater = _mm_and_si128(_mm_sub_epi32(_mm_or_si128(a, guard), b), guard);
+        const __m128i mask = _mm_sub_epi32(greater, _mm_srli_epi32(greater, 6));
+        return _mm_or_si128(_mm_and_si128(a, mask), _mm_andnot_si128(mask, b));
+    }
+
+    static inline __m128i Max24(const __m128i aA, const __m128i aB) throw() {
+        return _mm_or_si128(MaxEven(aA, aB), _mm_slli_epi32(MaxEven(_mm_srli_epi32(aA, 6), _mm_srli_epi32(aB, 6)), 6));
+    }
+
+    // Moves 4 groups of 3 bytes into the low bytes of 4 32 bit lanes, and back
+    static inline __m128i Unpack24() throw() {
+        return _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    }
+
+    static inline __m128i Pack24() throw() {
+        return _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+    }
+
+    static inline void Store12(uint8_t* const aDestination, const __m128i aValue) throw() {
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(aDestination), aValue);
+        const uint32_t high = static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(aValue, 8)));
+        std::memcpy(aDestination + 8, &high, sizeof(uint32_t));
+    }
+#endif
+
+#if SOLAIRE_HYPER_LOG_LOG_AVX2
+    static inline __m256i MaxEven(const __m256i aA, const __m256i aB) throw() {
+        const __m256i registers = _mm256_set1_epi32(EVEN_REGISTERS);
+        const __m256i guard = _mm256_set1_epi32(GUARD_BITS);
+        const __m256i a = _mm256_and_si256(aA, registers);
+        const __m256i b = _mm256_and_si256(aB, registers);
+        const __m256i greater = _mm256_and_si256(_mm256_sub_epi32(_mm256_or_si256(a, guard), b), guard);
+        const __m256i mask = _mm256_sub_epi32(greater, _mm256_srli_epi32(greater, 6));
+        return _mm256_or_si256(_mm256_and_si256(a, mask), _mm256_andnot_si256(mask, b));
+    }
+
+    static inline __m256i Load24x8(const uint8_t* const aData) throw() {
+        // Each 128 bit half holds 12 bytes, the shuffle works within halves
+        const __m256i bytes = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(aData))),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(aData + 12)),
+            1
+        );
+        return _mm256_shuffle_epi8(bytes, _mm256_broadcastsi128_si256(Unpack24()));
+    }
+#endif
+
+    void MergeRegisters(uint8_t* const aDestination, const uint8_t* const aSource, const size_t aBytes) throw() {
+        size_t i = 0;
+
+#if SOLAIRE_HYPER_LOG_LOG_AVX2
+        for(; i + 24 <= aBytes; i += 24) {
+            const __m256i a = Load24x8(aDestination + i);
+            const __m256i b = Load24x8(aSource + i);
+            const __m256i max = _mm256_or_si256(
+                MaxEven(a, b),
+                _mm256_slli_epi32(MaxEven(_mm256_srli_epi32(a, 6), _mm256_srli_epi32(b, 6)), 6)
+            );
+            const __m256i packed = _mm256_shuffle_epi8(max, _mm256_broadcastsi128_si256(Pack24()));
+            Store12(aDestination + i, _mm256_castsi256_si128(packed));
+            Store12(aDestination + i + 12, _mm256_extracti128_si256(packed, 1));
+        }
+#endif
+
+#if SOLAIRE_HYPER_LOG_LOG_SSSE3
+        for(; i + 12 <= aBytes; i += 12) {
+            const __m128i a = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(aDestination + i)), Unpack24());
+            const __m128i b = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(aSource + i)), Unpack24());
+            Store12(aDestination + i, _mm_shuffle_epi8(Max24(a, b), Pack24()));
+        }
+#endif
+
+        for(; i + 3 <= aBytes; i += 3) {
+            const uint32_t a = Read24(aDestination + i);
+            const uint32_t b = Read24(aSource + i);
+            const uint32_t max = MaxEven(a, b) | (MaxEven(a >> 6, b >> 6) << 6);
+            aDestination[i] = static_cast<uint8_t>(max);
+            aDestination[i + 1] = static_cast<uint8_t>(max >> 8);
+            aDestination[i + 2] = static_cast<uint8_t>(max >> 16);
+        }
+    }
+
+    void RegisterHistogram(const uint8_t* const aRegisters, const size_t aCount, uint32_t* const aHistogram) throw() {
+        // Four histograms so that consecutive increments rarely wait on the same counter
+        uint32_t histograms[4][HISTOGRAM_SIZE];
+        std::memset(histograms, 0, sizeof(histograms));
+
+        for(size_t i = 0; i < aCount / 4; ++i) {
+            const uint32_t bits = Read24(aRegisters + i * 3);
+            ++histograms[0][bits & 0x3F];
+            ++histograms[1][(bits >> 6) & 0x3F];
+            ++histograms[2][(bits >> 12) & 0x3F];
+            ++histograms[3][bits >> 18];
+        }
+
+        for(uint32_t i = 0; i < HISTOGRAM_SIZE; ++i) {
+            aHistogram[i] = histograms[0][i] + histograms[1][i] + histograms[2][i] + histograms[3][i];
+        }
+    }
+
+    static double Sigma(double aX) throw() {
+        if(aX == 1.0) return INFINITY;
+        double y = 1.0;
+        double z = aX;
+        double previous;
+        do {
+            aX *= aX;
+            previous = z;
+            z += aX * y;
+            y += y;
+        }while(z != previous);
+        return z;
+    }
+
+    static double Tau(double aX) throw() {
+        if(aX == 0.0 || aX == 1.0) return 0.0;
+        double y = 1.0;
+        double z = 1.0 - aX;
+        double previous;
+        do {
+            aX = std::sqrt(aX);
+            previous = z;
+            y *= 0.5;
+            z -= (1.0 - aX) * (1.0 - aX) * y;
+        }while(z != previous);
+        return z / 3.0;
+    }
+
+    double Estimate(const uint32_t* const aHistogram, const size_t aCount, const uint32_t aMaxRank) throw() {
+        const double count = static_cast<double>(aCount);
+        double z = count * Tau(1.0 - static_cast<double>(aHistogram[aMaxRank]) / count);
+        for(uint32_t i = aMaxRank - 1; i >= 1; --i) {
+            z = 0.5 * (z + static_cast<double>(aHistogram[i]));
+        }
+        z += count * Sigma(static_cast<double>(aHistogram[0]) / count);
+        return count * count / (2.0 * std::log(2.0) * z);
+    }
+
+    double LinearCount(const double aBuckets, const double aEmpty) throw() {
+        return aBuckets * std::log(aBuckets / aEmpty);
+    }
+}}
@@ -0,0 +1,52 @@
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+#include "Solaire\Maths\Hash\MultiChecksum.hpp"
+
+namespace Solaire{
+
+    // MultiChecksum
+
+    MultiChecksum::MultiChecksum(const uint64_t aSeed) throw() :
+        mHash64(aSeed)
+    {}
+
+    void MultiChecksum::Initialise() throw() {
+        mCrc.Initialise();
+        mAddler.Initialise();
+        mHash64.Initialise();
+    }
+
+    void MultiChecksum::Update(const void* const aValue, const size_t aBytes) throw() {
+        UpdateFused(aValue, aBytes, mCrc, mAddler, mHash64);
+    }
+
+    Checksums MultiChecksum::Finalise() const throw() {
+        Checksums checksums;
+        checksums.Crc = mCrc.Finalise();
+        checksums.Addler = mAddler.Finalise();
+        checksums.Hash64 = mHash64.Finalise();
+        return checksums;
+    }
+
+    Checksums MultiChecksum::Hash(const void* const aValue, const size_t aBytes, const uint64_t aSeed) throw() {
+        MultiChecksum checksum(aSeed);
+        checksum.Update(aValue, aBytes);
+        return checksum.Finalise();
+    }
+}
@@ -0,0 +1,36 @@
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+#include "Solaire\Maths\Hash\MurmurHash3.hpp"
+
+namespace Solaire{
+
+    // MurmurHash3
+
+    MurmurHash3::MurmurHash3(const uint32_t aSeed) throw() :
+        mSeed(aSeed)
+    {}
+
+    Hash128 MurmurHash3::Hash128Of(const void* const aValue, const size_t aBytes) const throw() {
+        return Hash128WithSeed(aValue, aBytes, mSeed);
+    }
+
+    MurmurHash3::HashType SOLAIRE_EXPORT_CALL MurmurHash3::Hash(const void* const aValue, const size_t aBytes) const throw() {
+        return HashWithSeed(aValue, aBytes, mSeed);
+    }
+}
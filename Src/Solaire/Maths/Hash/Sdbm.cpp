@@ -17,17 +17,63 @@
 // GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
 
 #include "Solaire\Maths\Hash\Sdbm.hpp"
+#include "Solaire\Maths\Hash\HashBatch.hpp"
 
 namespace Solaire{
 
+    namespace SdbmImplementation {
+        struct Lanes {
+            enum : uint32_t{
+                INITIAL_HASH = Sdbm::Policy::INITIAL_HASH
+            };
+
+            static inline uint32_t Update(const uint32_t aHash, const void* const aValue, const size_t aBytes) throw() {
+                return Sdbm::Policy::Update(aHash, aValue, aBytes);
+            }
+
+#if SOLAIRE_HASH_BATCH_SSE2
+            static inline __m128i Step(const __m128i aHash, const __m128i aByte) throw() {
+                return _mm_sub_epi32(_mm_add_epi32(_mm_add_epi32(aByte, _mm_slli_epi32(aHash, 6)), _mm_slli_epi32(aHash, 16)), aHash);
+            }
+#endif
+
+#if SOLAIRE_HASH_BATCH_AVX2
+            static inline __m256i Step(const __m256i aHash, const __m256i aByte) throw() {
+                return _mm256_sub_epi32(_mm256_add_epi32(_mm256_add_epi32(aByte, _mm256_slli_epi32(aHash, 6)), _mm256_slli_epi32(aHash, 16)), aHash);
+            }
+#endif
+        };
+    }
+
+    // Sdbm::State
+
+    Sdbm::State::State() throw() :
+        mHash(Policy::INITIAL_HASH)
+    {}
+
+    SOLAIRE_EXPORT_CALL Sdbm::State::~State() throw() {
+
+    }
+
+    void SOLAIRE_EXPORT_CALL Sdbm::State::Initialise() throw() {
+        mHash = Policy::INITIAL_HASH;
+    }
+
+    void SOLAIRE_EXPORT_CALL Sdbm::State::Update(const void* const aValue, const size_t aBytes) throw() {
+        mHash = Policy::Update(mHash, aValue, aBytes);
+    }
+
+    Sdbm::HashType SOLAIRE_EXPORT_CALL Sdbm::State::Finalise() const throw() {
+        return mHash;
+    }
+
     // Sdbm
        
 	Sdbm::HashType SOLAIRE_EXPORT_CALL Sdbm::Hash(const void* const aValue, const size_t aBytes) const throw() {
-        HashType hash = 0;
-		const uint8_t* const data = static_cast<const uint8_t*>(aValue);
-		for(size_t i = 0; i < aBytes; ++i){
-			hash = data[i] + (hash << 6) + (hash << 16) - hash;
-		}
-		return hash;
+        return Policy::Hash(aValue, aBytes);
+    }
+
+	void SOLAIRE_EXPORT_CALL Sdbm::HashBatch(const void* const* const aKeys, const size_t* const aLengths, HashType* const aHashes, const size_t aCount) const throw() {
+        HashBatchImplementation::HashBatch<SdbmImplementation::Lanes>(aKeys, aLengths, aHashes, aCount);
     }
 }
\ No newline at end of file
@@ -0,0 +1,49 @@
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+#include <chrono>
+#include <random>
+#include "Solaire\Maths\Hash\SipHash.hpp"
+
+namespace Solaire{
+
+    namespace SipHashImplementation {
+        static uint64_t SplitMix64(uint64_t& aState) throw() {
+            uint64_t z = (aState += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+        }
+
+        SipHashKey RandomKey() throw() {
+            SipHashKey key;
+            try{
+                std::random_device device;
+                key.K0 = (static_cast<uint64_t>(device()) << 32) | device();
+                key.K1 = (static_cast<uint64_t>(device()) << 32) | device();
+            }catch(...) {
+                uint64_t state =
+                    static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count()) ^
+                    static_cast<uint64_t>(reinterpret_cast<uintptr_t>(&key));
+                key.K0 = SplitMix64(state);
+                key.K1 = SplitMix64(state);
+            }
+            return key;
+        }
+    }
+}
@@ -0,0 +1,193 @@
+//Copyright 2015 Adam Smith
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Contact :
+// Email             : solairelibrary@mail.com
+// GitHub repository : https://github.com/SolaireLibrary/SolaireCPP
+
+#include <algorithm>
+#include "Solaire\Maths\Hash\XxHash.hpp"
+
+namespace Solaire{
+
+    // XxHash64::State
+
+    XxHash64::State::State(const uint64_t aSeed) throw() :
+        mTotalBytes(0),
+        mSeed(aSeed),
+        mBufferedBytes(0)
+    {
+        InitialiseAccumulators(mAccumulators, mSeed);
+    }
+
+    SOLAIRE_EXPORT_CALL XxHash64::State::~State() throw() {
+
+    }
+
+    void SOLAIRE_EXPORT_CALL XxHash64::State::Initialise() throw() {
+        InitialiseAccumulators(mAccumulators, mSeed);
+        mTotalBytes = 0;
+        mBufferedBytes = 0;
+    }
+
+    void SOLAIRE_EXPORT_CALL XxHash64::State::Update(const void* const aValue, const size_t aBytes) throw() {
+        const uint8_t* data = static_cast<const uint8_t*>(aValue);
+        size_t bytes = aBytes;
+        mTotalBytes += aBytes;
+
+        // Complete a partially filled stripe
+        if(mBufferedBytes > 0) {
+            const size_t count = std::min<size_t>(STRIPE_SIZE - mBufferedBytes, bytes);
+            std::memcpy(mBuffer + mBufferedBytes, data, count);
+            mBufferedBytes += static_cast<uint32_t>(count);
+            data += count;
+            bytes -= count;
+            if(mBufferedBytes < STRIPE_SIZE) return;
+            UpdateStripes(mAccumulators, mBuffer, STRIPE_SIZE);
+            mBufferedBytes = 0;
+        }
+
+        const size_t processed = UpdateStripes(mAccumulators, data, bytes);
+        mBufferedBytes = static_cast<uint32_t>(bytes - processed);
+        std::memcpy(mBuffer, data + processed, mBufferedBytes);
+    }
+
+    XxHash64::HashType SOLAIRE_EXPORT_CALL XxHash64::State::Finalise() const throw() {
+        const uint64_t hash = mTotalBytes >= STRIPE_SIZE ?
+            MergeAccumulators(mAccumulators) :
+            mSeed + XxHashImplementation::PRIME64_5;
+        return Finish(hash + mTotalBytes, mBuffer, mBufferedBytes);
+    }
+
+    // XxHash64
+
+    XxHash64::XxHash64(const uint64_t aSeed) throw() :
+        mSeed(aSeed)
+    {}
+
+    XxHash64::HashType SOLAIRE_EXPORT_CALL XxHash64::Hash(const void* const aValue, const size_t aBytes) const throw() {
+        return HashWithSeed(aValue, aBytes, mSeed);
+    }
+
+    // Xxh3::State
+
+    Xxh3::State::State(const uint64_t aSeed) throw() :
+        mTotalBytes(0),
+        mSeed(aSeed),
+        mBufferedBytes(0),
+        mStripes(0)
+    {
+        InitialiseAccumulators(mAccumulators);
+        SeedSecret(mSecret, aSeed);
+    }
+
+    SOLAIRE_EXPORT_CALL Xxh3::State::~State() throw() {
+
+    }
+
+    void SOLAIRE_EXPORT_CALL Xxh3::State::Initialise() throw() {
+        InitialiseAccumulators(mAccumulators);
+        mTotalBytes = 0;
+        mBufferedBytes = 0;
+        mStripes = 0;
+    }
+
+    void SOLAIRE_EXPORT_CALL Xxh3::State::Update(const void* const aValue, const size_t aBytes) throw() {
+        enum : size_t{
+            BUFFER_STRIPES = BUFFER_SIZE / STRIPE_SIZE
+        };
+
+        const uint8_t* data = static_cast<const uint8_t*>(aValue);
+        size_t bytes = aBytes;
+        mTotalBytes += aBytes;
+
+        if(mBufferedBytes + bytes <= BUFFER_SIZE) {
+            std::memcpy(mBuffer + mBufferedBytes, data, bytes);
+            mBufferedBytes += static_cast<uint32_t>(bytes);
+            return;
+        }
+
+        // The buffer is only consumed once more data arrives so that the last stripe is always available to Finalise
+        if(mBufferedBytes > 0) {
+            const size_t count = BUFFER_SIZE - mBufferedBytes;
+            std::memcpy(mBuffer + mBufferedBytes, data, count);
+            data += count;
+            bytes -= count;
+            mStripes = AccumulateBlocks(mAccumulators, mBuffer, BUFFER_STRIPES, mStripes, mSecret);
+            mBufferedBytes = 0;
+        }
+
+        if(bytes > BUFFER_SIZE) {
+            do {
+                mStripes = AccumulateBlocks(mAccumulators, data, BUFFER_STRIPES, mStripes, mSecret);
+                data += BUFFER_SIZE;
+                bytes -= BUFFER_SIZE;
+            }while(bytes > BUFFER_SIZE);
+
+            // Keep the last stripe in case Finalise needs it
+            std::memcpy(mBuffer + BUFFER_SIZE - STRIPE_SIZE, data - STRIPE_SIZE, STRIPE_SIZE);
+        }
+
+        std::memcpy(mBuffer, data, bytes);
+        mBufferedBytes = static_cast<uint32_t>(bytes);
+    }
+
+    void Xxh3::State::AccumulateBuffer(uint64_t* const aAccumulators) const throw() {
+        std::memcpy(aAccumulators, mAccumulators, sizeof(mAccumulators));
+        const uint8_t* const lastSecret = mSecret + SECRET_SIZE - STRIPE_SIZE - SECRET_LAST_START;
+
+        if(mBufferedBytes >= STRIPE_SIZE) {
+            const size_t stripes = (mBufferedBytes - 1) / STRIPE_SIZE;
+            AccumulateBlocks(aAccumulators, mBuffer, stripes, mStripes, mSecret);
+            Accumulate(aAccumulators, mBuffer + mBufferedBytes - STRIPE_SIZE, lastSecret);
+        }else {
+            // The last stripe starts in the data that was consumed before the buffer was refilled
+            uint8_t stripe[STRIPE_SIZE];
+            const size_t previous = STRIPE_SIZE - mBufferedBytes;
+            std::memcpy(stripe, mBuffer + BUFFER_SIZE - previous, previous);
+            std::memcpy(stripe + previous, mBuffer, mBufferedBytes);
+            Accumulate(aAccumulators, stripe, lastSecret);
+        }
+    }
+
+    Hash128 Xxh3::State::Finalise128() const throw() {
+        if(mTotalBytes <= MID_SIZE_MAX) return Hash128WithSeed(mBuffer, static_cast<size_t>(mTotalBytes), mSeed);
+
+        uint64_t accumulators[ACCUMULATORS];
+        AccumulateBuffer(accumulators);
+        return Finish128(accumulators, mSecret, mTotalBytes);
+    }
+
+    Xxh3::HashType SOLAIRE_EXPORT_CALL Xxh3::State::Finalise() const throw() {
+        if(mTotalBytes <= MID_SIZE_MAX) return HashWithSeed(mBuffer, static_cast<size_t>(mTotalBytes), mSeed);
+
+        uint64_t accumulators[ACCUMULATORS];
+        AccumulateBuffer(accumulators);
+        return Finish64(accumulators, mSecret, mTotalBytes);
+    }
+
+    // Xxh3
+
+    Xxh3::Xxh3(const uint64_t aSeed) throw() :
+        mSeed(aSeed)
+    {}
+
+    Hash128 Xxh3::Hash128Of(const void* const aValue, const size_t aBytes) const throw() {
+        return Hash128WithSeed(aValue, aBytes, mSeed);
+    }
+
+    Xxh3::HashType SOLAIRE_EXPORT_CALL Xxh3::Hash(const void* const aValue, const size_t aBytes) const throw() {
+        return HashWithSeed(aValue, aBytes, mSeed);
+    }
+}